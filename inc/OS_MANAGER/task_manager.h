@@ -30,6 +30,9 @@ extern "C"
 #define STACK_SIZE_REAL_WORLD       STACK_SIZE(2)
 #define STACK_SIZE_CONTROLLER       STACK_SIZE(5)
 #define STACK_SIZE_IDENTIFICACION   STACK_SIZE(5)
+#define STACK_SIZE_ESTIMACION       STACK_SIZE(5)
+#define STACK_SIZE_TELEMETRY        STACK_SIZE(4)
+#define STACK_SIZE_BODE             STACK_SIZE(5)
 
 /*================ PUBLIC DATA TYPE ====================================================*/
 
@@ -21,19 +21,11 @@ extern "C"
 
 /*================ PUBLIC MACRO AND CONSTANTS ==========================================*/
 
-/*================ PUBLIC DATA TYPE ====================================================*/
-
-typedef enum {
-    #ifdef TEST
-    TIMER_INDEX_TEST_1,
-    TIMER_INDEX_TEST_2,
-    #else
-    TIMER_GENERIC_1,
-    #endif
+#define TIMER_WHEEL_SLOTS       64  /**< Slots of the timer wheel, a power of 2. */
 
-    TIMER_INDEX_QTY
-} timer_index_t;
+#define TIMER_WHEEL_TICK_MS     1   /**< Period of the kernel timer that turns the wheel. */
 
+/*================ PUBLIC DATA TYPE ====================================================*/
 
 /*================ PUBLIC FUNCTION DECLARATIONS ========================================*/
 
@@ -0,0 +1,137 @@
+/**
+ * @file arx.h
+ * @author Marcos Dominguez
+ *
+ * @brief Regressor of ARX and ARMAX models of configurable order.
+ *
+ * The model is A(q) y[k] = B(q) u[k - nk] + C(q) e[k] with
+ *
+ *     A(q) = 1 + a1 q^-1 + ... + a_na q^-na
+ *     B(q) = b0 + b1 q^-1 + ... + b_(nb-1) q^-(nb-1)
+ *     C(q) = 1 + c1 q^-1 + ... + c_nc q^-nc
+ *
+ * so theta = [a1 .. a_na, b0 .. b_(nb-1), c1 .. c_nc] and the regressor is
+ * phi = [-y[k-1] .. -y[k-na], u[k-nk] .. u[k-nk-nb+1], e[k-1] .. e[k-nc]].
+ * The regressor lives in the instance and is shifted in place every sample,
+ * so the estimators read it directly. nc > 0 (ARMAX) needs the residuals of a
+ * recursive estimator, a pseudo-linear regression.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef ARX_H
+#define ARX_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define ARX_MAX_PARAMS  8   /**< Largest na + nb + nc. */
+
+#define ARX_MAX_DELAY   8   /**< Largest dead time nk in samples. */
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Model structure and regressor.
+ */
+typedef struct {
+    float phi[ARX_MAX_PARAMS];          /**< Regressor of the current sample. */
+    float u_delay[ARX_MAX_DELAY];       /**< u[k-1] .. u[k-nk], inputs still inside the dead time. */
+    uint8_t na;                         /**< Poles. */
+    uint8_t nb;                         /**< Zeros plus one. */
+    uint8_t nc;                         /**< Noise model order, 0 for ARX. */
+    uint8_t nk;                         /**< Dead time in samples. */
+    uint16_t samples;                   /**< Samples pushed until the regressor is full. */
+} arx_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the model structure and clear the regressor.
+ *
+ * @param arx       Instance.
+ * @param na        Order of A.
+ * @param nb        Coefficients of B, at least 1.
+ * @param nk        Dead time in samples, up to ARX_MAX_DELAY.
+ * @param nc        Order of C, 0 for ARX.
+ * @return bool_t   TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t ARX_Init(arx_t *arx, uint8_t na, uint8_t nb, uint8_t nk, uint8_t nc);
+
+/**
+ * @brief Clear the regressor, the model structure is kept.
+ *
+ * @param arx       Instance.
+ */
+void ARX_Reset(arx_t *arx);
+
+/**
+ * @brief Number of parameters na + nb + nc.
+ *
+ * @param arx       Instance.
+ * @return uint8_t  Length of theta and phi.
+ */
+uint8_t ARX_NumParams(const arx_t *arx);
+
+/**
+ * @brief Enter the input of sample k and get the regressor that predicts y[k].
+ *
+ * @param arx           Instance.
+ * @param u             Input u[k].
+ * @return const float* Regressor, valid until ARX_Advance.
+ */
+const float *ARX_Regressor(arx_t *arx, float u);
+
+/**
+ * @brief Whether the regressor holds no samples from before the start.
+ *
+ * @param arx       Instance.
+ * @return bool_t   TRUE: Regressor complete - FALSE: Still filling.
+ */
+bool_t ARX_Ready(const arx_t *arx);
+
+/**
+ * @brief Residual y[k] - phi' theta of the current regressor.
+ *
+ * @param arx       Instance.
+ * @param theta     Parameters.
+ * @param y         Output y[k].
+ * @return float    Residual.
+ */
+float ARX_Residual(const arx_t *arx, const float *theta, float y);
+
+/**
+ * @brief Close sample k, shifting y[k] and e[k] into the regressor.
+ *
+ * @param arx       Instance.
+ * @param y         Output y[k].
+ * @param e         Residual e[k], ignored when nc is 0.
+ */
+void ARX_Advance(arx_t *arx, float y, float e);
+
+/**
+ * @brief Split theta in the polynomials of the model.
+ *
+ * @param arx       Instance.
+ * @param theta     Parameters.
+ * @param den       A, na + 1 coefficients starting with 1.
+ * @param num       B, nb coefficients. The dead time is not included.
+ * @param noise     C, nc + 1 coefficients starting with 1, may be NULL.
+ */
+void ARX_GetPolynomials(const arx_t *arx, const float *theta, float *den, float *num, float *noise);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* ARX_H */
@@ -0,0 +1,114 @@
+/**
+ * @file autotune.h
+ * @author Marcos Dominguez
+ *
+ * @brief Controller synthesis from an identified second order model.
+ *
+ * The model is the ARX fit (b0 + b1 z^-1 + b2 z^-2) / (1 + a1 z^-1 + a2 z^-2)
+ * without dead time. b0 is dropped, a sampled plant has no direct feedthrough
+ * and the fit only gives it noise.
+ *
+ * - PID: S(z) / ((1 - z^-1)(1 + r1 z^-1)) with S of second order, a PID with
+ *   filtered derivative, solving the Diophantine equation A R + B S = P for
+ *   the four closed loop poles. They are kept apart from the state feedback
+ *   ones: the deadbeat-like pole of the latter in the negative axis makes the
+ *   PID action alternate far outside the 0 - 3.3 V of the DAC.
+ * - Observed pole placement: the same realization as the controller,
+ *   A = [-a1 -a2; 1 0], B = [1; 0], C = [b1 b2], with K and L by Ackermann
+ *   and Ko for unity DC gain.
+ *
+ * AUTOTUNE_Apply publishes both to the running controllers.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef AUTOTUNE_H
+#define AUTOTUNE_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+#include "pid.h"
+#include "control.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define AUTOTUNE_PID_POLE_S_SLOW    (-44.62871026284194)    /**< Default dominant pair of the PID loop in rad/s, about 22 ms. */
+#define AUTOTUNE_PID_POLE_S_FAST    (-138.62943611198907)   /**< Default pair added by the filtered derivative, in rad/s. */
+
+#define AUTOTUNE_PID_POLE_SLOW  DISCRETIZE_EXP(AUTOTUNE_PID_POLE_S_SLOW * CONTROL_TS)
+#define AUTOTUNE_PID_POLE_FAST  DISCRETIZE_EXP(AUTOTUNE_PID_POLE_S_FAST * CONTROL_TS)
+
+#define AUTOTUNE_MAX_SHIFT  12      /**< Largest gain shift of the PID numerator. */
+
+/**
+ * @brief Poles the controllers in use were designed with.
+ */
+#define AUTOTUNE_POLES_DEFAULT {                                \
+    .control = {CONTROL_POLE_1, CONTROL_POLE_2},                \
+    .observer = {OBSERVER_POLE_1, OBSERVER_POLE_2},             \
+    .pid = {AUTOTUNE_PID_POLE_SLOW, AUTOTUNE_PID_POLE_SLOW,     \
+            AUTOTUNE_PID_POLE_FAST, AUTOTUNE_PID_POLE_FAST},    \
+}
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Requested closed loop poles, real and in z.
+ */
+typedef struct {
+    float control[2];   /**< Poles of the state feedback. */
+    float observer[2];  /**< Poles of the observer. */
+    float pid[4];       /**< Poles of the PID loop. */
+} autotune_poles_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Design the PID biquad.
+ *
+ * @param den       1, a1, a2.
+ * @param num       b0, b1, b2.
+ * @param poles     Requested poles.
+ * @param tuning    Coefficients, with unity reference weight.
+ * @return bool_t   TRUE: Operation success - FALSE: Common factor between den and num, or unstable controller pole.
+ */
+bool_t AUTOTUNE_PidSynthesize(const float *den, const float *num, const autotune_poles_t *poles, pid_tuning_t *tuning);
+
+/**
+ * @brief Design the observed pole placement controller.
+ *
+ * @param den       1, a1, a2.
+ * @param num       b0, b1, b2.
+ * @param poles     Requested poles.
+ * @param tuning    Model, observer gain and state feedback.
+ * @return bool_t   TRUE: Operation success - FALSE: Model not observable or zero DC gain.
+ */
+bool_t AUTOTUNE_ObserverSynthesize(const float *den, const float *num, const autotune_poles_t *poles, controller_observer_tuning_t *tuning);
+
+/**
+ * @brief Design both controllers and publish them to the running ones.
+ *
+ * Each design goes to the buffer that is not active, so calls must be more
+ * than one control period apart. A design that fails leaves the active
+ * tuning of that controller untouched.
+ *
+ * @param den       1, a1, a2.
+ * @param num       b0, b1, b2.
+ * @param poles     Requested poles.
+ * @return bool_t   TRUE: Both published - FALSE: At least one failed.
+ */
+bool_t AUTOTUNE_Apply(const float *den, const float *num, const autotune_poles_t *poles);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* AUTOTUNE_H */
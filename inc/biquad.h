@@ -0,0 +1,138 @@
+/**
+ * @file biquad.h
+ * @author Marcos Dominguez
+ *
+ * @brief Cascade of second order sections in transposed direct form II.
+ *
+ * Coefficients are Q2.30 so |a1| up to 2 can be represented, the state of each
+ * section is Q31 and every product is accumulated in 64 bits with saturation
+ * on the way back to 32 bits. Splitting a filter in sections keeps the poles
+ * where they were designed even at high sample rates.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include <stddef.h>
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define BIQUAD_COEFS_PER_STAGE  5   /**< {b0, b1, b2, a1, a2} for each section. */
+#define BIQUAD_STATE_PER_STAGE  2   /**< {s1, s2} for each section. */
+
+#define BIQUAD_COEF_SHIFT       30  /**< Fractional bits of the coefficients. */
+
+/**
+ * @brief Guard bits of the Q31 signal inside the cascade.
+ *
+ * A Q15 sample is converted to Q31 scaled by 2^-BIQUAD_HEADROOM_BITS, so
+ * intermediate values up to +-(1 << BIQUAD_HEADROOM_BITS) do not saturate.
+ */
+#define BIQUAD_HEADROOM_BITS    4
+
+/**
+ * @brief Convert a floating point coefficient to Q2.30.
+ */
+#define BIQUAD_COEF(x)          ((int32_t)((x) * (double)(1L << BIQUAD_COEF_SHIFT)))
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Biquad cascade instance.
+ *
+ * The coefficient array has BIQUAD_COEFS_PER_STAGE elements for each section
+ * and the denominator of every section is 1 + a1 z^-1 + a2 z^-2. The state
+ * array has BIQUAD_STATE_PER_STAGE elements for each section and is owned by
+ * the caller.
+ */
+typedef struct {
+    const int32_t *coefs;   /**< Coefficients of every section in Q2.30. */
+    int32_t *state;         /**< State of every section in Q31. */
+    uint8_t num_stages;     /**< Number of second order sections. */
+} biquad_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the cascade struct and clear its state.
+ *
+ * @param filter        Filter instance.
+ * @param coefs         Coefficients, BIQUAD_COEFS_PER_STAGE per section.
+ * @param state         State buffer, BIQUAD_STATE_PER_STAGE per section.
+ * @param num_stages    Number of sections.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t BIQUAD_Init(biquad_t *filter, const int32_t *coefs, int32_t *state, uint8_t num_stages);
+
+/**
+ * @brief Clear the state of every section.
+ *
+ * @param filter        Filter instance.
+ */
+void BIQUAD_Reset(biquad_t *filter);
+
+/**
+ * @brief Process one Q31 sample through the whole cascade.
+ *
+ * @param filter        Filter instance.
+ * @param input         Input sample in Q31.
+ * @return int32_t      Output sample in Q31.
+ */
+int32_t BIQUAD_Step(biquad_t *filter, int32_t input);
+
+/**
+ * @brief Process one Q15 sample through the whole cascade.
+ *
+ * The sample is moved to Q31 keeping BIQUAD_HEADROOM_BITS of headroom and the
+ * result is brought back to Q15.
+ *
+ * @param filter        Filter instance.
+ * @param input         Input sample in Q15.
+ * @return int32_t      Output sample in Q15.
+ */
+int32_t BIQUAD_StepQ15(biquad_t *filter, int32_t input);
+
+/**
+ * @brief Process a block of Q31 samples through the whole cascade.
+ *
+ * The result is bit-exact with calling BIQUAD_Step for every sample. On the
+ * host the feed-forward products are computed with SSE4.1/AVX2 when the
+ * compiler targets them. Input and output may be the same buffer.
+ *
+ * @param filter        Filter instance.
+ * @param input         Input samples in Q31.
+ * @param output        Output samples in Q31.
+ * @param size          Number of samples.
+ */
+void BIQUAD_StepBlock(biquad_t *filter, const int32_t *input, int32_t *output, size_t size);
+
+/**
+ * @brief Process a block of Q15 samples through the whole cascade.
+ *
+ * The result is bit-exact with calling BIQUAD_StepQ15 for every sample.
+ * Input and output may be the same buffer.
+ *
+ * @param filter        Filter instance.
+ * @param input         Input samples in Q15.
+ * @param output        Output samples in Q15.
+ * @param size          Number of samples.
+ */
+void BIQUAD_StepBlockQ15(biquad_t *filter, const int32_t *input, int32_t *output, size_t size);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* BIQUAD_H */
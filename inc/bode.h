@@ -0,0 +1,46 @@
+/**
+ * @file bode.h
+ * @author Marcos Dominguez
+ *
+ * @brief Stepped sine measurement of the frequency response of the plant.
+ *
+ * A task drives the DAC with one sine at a time, lets the transient die out
+ * and feeds the applied input and the measured output to one Goertzel filter
+ * each. Their ratio gives the gain and the phase at that frequency, which are
+ * printed through the UART before moving to the next one. Nothing is stored
+ * but the two filters, whatever the length of the measurement. The sweep
+ * starts again after the last frequency.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef BODE_H
+#define BODE_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Create the task that sweeps the frequencies.
+ */
+void BODE_Init(void);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* BODE_H */
@@ -20,16 +20,67 @@ extern "C" {
 
 #include "data_types.h"
 #include "utils.h"
+#include "osal_profiler.h"
+#include "pole_placement.h"
+#include "control_config.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
 #define PERIODO_SQUARE 1
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
+/**
+ * @brief Model, observer gain and state feedback of the observed pole placement
+ * controller, swapped as a whole while it runs.
+ */
+typedef struct {
+    pole_placement_model_t model;   /**< Model and observer gain. */
+    pole_placement_gain_t gain;     /**< State feedback and reference gain. */
+} controller_observer_tuning_t;
+
+/**
+ * @brief Called by the running controller once a sample, after the action is
+ * written to the DAC.
+ *
+ * @param u_mv      Action written in the sample.
+ * @param y_mv      Output read at the start of the sample.
+ * @return int32_t  Offset in mV added to the action of the next sample.
+ */
+typedef int32_t (*controller_hook_t)(int32_t u_mv, int32_t y_mv);
+
 /*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
 
 void CONTROLLER_Init(void);
 
+/**
+ * @brief Copy the timing of the control loop: execution time, release jitter,
+ * response time and deadline misses against the TS_MS period.
+ *
+ * @param snapshot  Where the copy is stored.
+ * @return bool_t   TRUE: Operation success - FALSE: Operation fail, or the loop was updating it, see OSAL_PROFILER_Get.
+ */
+bool_t CONTROLLER_GetTiming(osal_profiler_t *snapshot);
+
+/**
+ * @brief Publish a new tuning to the observed pole placement controller.
+ *
+ * The pointer is published atomically and the next sample uses the whole
+ * new set, the estimated state is kept. The tuning must stay unchanged while
+ * it is active and for one sample after it is replaced.
+ *
+ * @param tuning    Tuning, NULL restores the built-in one.
+ */
+void CONTROLLER_SetObserverTuning(const controller_observer_tuning_t *tuning);
+
+/**
+ * @brief Sample the running controller and excite it from outside, as the
+ * closed loop identification does.
+ *
+ * @param hook  Called every sample from the control task, it must not block. NULL removes it.
+ */
+void CONTROLLER_SetHook(controller_hook_t hook);
+
 #ifdef  __cplusplus
 }
 
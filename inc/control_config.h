@@ -0,0 +1,61 @@
+/**
+ * @file control_config.h
+ * @author Marcos Dominguez
+ *
+ * @brief Sample period, plant model and pole locations shared by the
+ * controllers, the filters and the simulated plant. Everything given in
+ * continuous time is sampled at TS_MS, so changing it keeps them consistent.
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ */
+
+#ifndef CONTROL_CONFIG_H
+#define CONTROL_CONFIG_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "discretize.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define TS_MS         5     /**< Sample period in ms of the control loop and of the simulated plant. */
+
+#define CONTROL_TS    DISCRETIZE_MS_TO_S(TS_MS)     /**< Sample period in s. */
+
+/* Identified model of the plant used by the observers: two real poles in
+ * rad/s and its DC gain, sampled with ZOH at TS_MS */
+#define MODEL_POLE_1        (-31.801642015485033)
+#define MODEL_POLE_2        (-185.35388130028664)
+#define MODEL_DC_GAIN       (1.0)
+
+/* Closed loop poles of the observed controller in rad/s, mapped with z = e^(s ts).
+ * The second one sits at the Nyquist frequency, z = -e^(sigma ts): it decays
+ * at sigma and alternates sign every sample */
+#define CONTROL_POLE_S_1        (-65.0035605596015)
+#define CONTROL_POLE_SIGMA_2    (-36.82675459371295)
+
+#define CONTROL_POLE_1      DISCRETIZE_EXP(CONTROL_POLE_S_1 * CONTROL_TS)
+#define CONTROL_POLE_2      (-DISCRETIZE_EXP(CONTROL_POLE_SIGMA_2 * CONTROL_TS))
+
+/* Observer poles in rad/s */
+#define OBSERVER_POLE_S_1   (-6.324505310683147)
+#define OBSERVER_POLE_S_2   (-6.957069901974894)
+
+#define OBSERVER_POLE_1     DISCRETIZE_EXP(OBSERVER_POLE_S_1 * CONTROL_TS)
+#define OBSERVER_POLE_2     DISCRETIZE_EXP(OBSERVER_POLE_S_2 * CONTROL_TS)
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* CONTROL_CONFIG_H */
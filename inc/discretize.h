@@ -0,0 +1,182 @@
+/**
+ * @file discretize.h
+ * @author Marcos Dominguez
+ *
+ * @brief Compile-time discretization of controllers and plants.
+ *
+ * Every macro expands to a constant expression, so the coefficients are
+ * folded by the compiler and can be used in static initializers. Times are in
+ * seconds and poles/zeros in rad/s (real, left half plane).
+ *
+ * The exponentials of the ZOH and pole mapping macros use __builtin_exp and
+ * __builtin_cos, which GCC folds at compile time when the arguments are
+ * constants.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef DISCRETIZE_H
+#define DISCRETIZE_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "biquad.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define DISCRETIZE_MS_TO_S(ms)      ((ms) / 1000.0)
+
+#define DISCRETIZE_EXP(x)           __builtin_exp(x)
+
+#define DISCRETIZE_COS(x)           __builtin_cos(x)
+
+#define DISCRETIZE_SQRT(x)          __builtin_sqrt(x)
+
+/*--------- Tustin of a second order transfer function --------------------------
+ *
+ *          n2 s^2 + n1 s + n0           b0 + b1 z^-1 + b2 z^-2
+ *  H(s) = --------------------   ->    ------------------------
+ *          d2 s^2 + d1 s + d0            1 + a1 z^-1 + a2 z^-2
+ *
+ *  with s = (2 / ts) (z - 1) / (z + 1).
+ */
+
+#define DISCRETIZE_TUSTIN_K(ts)                         (2.0 / (ts))
+
+#define DISCRETIZE_TUSTIN_POLY_P(c2, c1, c0, ts)        (((c2) * DISCRETIZE_TUSTIN_K(ts) * DISCRETIZE_TUSTIN_K(ts)) + ((c1) * DISCRETIZE_TUSTIN_K(ts)) + (c0))
+#define DISCRETIZE_TUSTIN_POLY_M(c2, c1, c0, ts)        (((c2) * DISCRETIZE_TUSTIN_K(ts) * DISCRETIZE_TUSTIN_K(ts)) - ((c1) * DISCRETIZE_TUSTIN_K(ts)) + (c0))
+#define DISCRETIZE_TUSTIN_POLY_0(c2, c0, ts)            (2.0 * ((c0) - ((c2) * DISCRETIZE_TUSTIN_K(ts) * DISCRETIZE_TUSTIN_K(ts))))
+
+#define DISCRETIZE_TUSTIN_B0(n2, n1, n0, d2, d1, d0, ts) (DISCRETIZE_TUSTIN_POLY_P(n2, n1, n0, ts) / DISCRETIZE_TUSTIN_POLY_P(d2, d1, d0, ts))
+#define DISCRETIZE_TUSTIN_B1(n2, n1, n0, d2, d1, d0, ts) (DISCRETIZE_TUSTIN_POLY_0(n2, n0, ts) / DISCRETIZE_TUSTIN_POLY_P(d2, d1, d0, ts))
+#define DISCRETIZE_TUSTIN_B2(n2, n1, n0, d2, d1, d0, ts) (DISCRETIZE_TUSTIN_POLY_M(n2, n1, n0, ts) / DISCRETIZE_TUSTIN_POLY_P(d2, d1, d0, ts))
+#define DISCRETIZE_TUSTIN_A1(d2, d1, d0, ts)             (DISCRETIZE_TUSTIN_POLY_0(d2, d0, ts) / DISCRETIZE_TUSTIN_POLY_P(d2, d1, d0, ts))
+#define DISCRETIZE_TUSTIN_A2(d2, d1, d0, ts)             (DISCRETIZE_TUSTIN_POLY_M(d2, d1, d0, ts) / DISCRETIZE_TUSTIN_POLY_P(d2, d1, d0, ts))
+
+/**
+ * @brief Biquad section {b0, b1, b2, a1, a2} in Q2.30 of a second order transfer function.
+ */
+#define DISCRETIZE_TUSTIN_SOS(n2, n1, n0, d2, d1, d0, ts)           \
+    BIQUAD_COEF(DISCRETIZE_TUSTIN_B0(n2, n1, n0, d2, d1, d0, ts)),  \
+    BIQUAD_COEF(DISCRETIZE_TUSTIN_B1(n2, n1, n0, d2, d1, d0, ts)),  \
+    BIQUAD_COEF(DISCRETIZE_TUSTIN_B2(n2, n1, n0, d2, d1, d0, ts)),  \
+    BIQUAD_COEF(DISCRETIZE_TUSTIN_A1(d2, d1, d0, ts)),              \
+    BIQUAD_COEF(DISCRETIZE_TUSTIN_A2(d2, d1, d0, ts))
+
+/**
+ * @brief Biquad section of k (s - z1)(s - z2) / ((s - p1)(s - p2)) with k set by the DC gain.
+ */
+#define DISCRETIZE_TUSTIN_ZPK_SOS(z1, z2, p1, p2, dc_gain, ts)                                  \
+    DISCRETIZE_TUSTIN_SOS(DISCRETIZE_ZPK_K(z1, z2, p1, p2, dc_gain),                            \
+                          -DISCRETIZE_ZPK_K(z1, z2, p1, p2, dc_gain) * ((z1) + (z2)),           \
+                          DISCRETIZE_ZPK_K(z1, z2, p1, p2, dc_gain) * (z1) * (z2),              \
+                          1.0, -((p1) + (p2)), (p1) * (p2), ts)
+
+#define DISCRETIZE_ZPK_K(z1, z2, p1, p2, dc_gain)       ((dc_gain) * (p1) * (p2) / ((z1) * (z2)))
+
+/**
+ * @brief Biquad section of a PID with filtered derivative: kp + ki / s + kd s / (tf s + 1).
+ *
+ * tf must be greater than zero.
+ */
+#define DISCRETIZE_TUSTIN_PID_SOS(kp, ki, kd, tf, ts)   \
+    DISCRETIZE_TUSTIN_SOS(((kp) * (tf)) + (kd), (kp) + ((ki) * (tf)), (ki), (tf), 1.0, 0.0, ts)
+
+/*--------- ZOH of a plant with two real poles -----------------------------------
+ *
+ *              g p1 p2                   b1 z^-1 + b2 z^-2
+ *  G(s) = ----------------   ->   ----------------------------
+ *          (s - p1)(s - p2)          1 + a1 z^-1 + a2 z^-2
+ */
+
+#define DISCRETIZE_ZOH_E(p, ts)                 DISCRETIZE_EXP((p) * (ts))
+#define DISCRETIZE_ZOH_C1(p1, p2, g)            ((g) * (p2) / ((p1) - (p2)))
+#define DISCRETIZE_ZOH_C2(p1, p2, g)            ((g) * (p1) / ((p2) - (p1)))
+
+#define DISCRETIZE_ZOH_2POLE_B1(p1, p2, g, ts)                                                  \
+    (-((g) * (DISCRETIZE_ZOH_E(p1, ts) + DISCRETIZE_ZOH_E(p2, ts)))                             \
+     - (DISCRETIZE_ZOH_C1(p1, p2, g) * (1.0 + DISCRETIZE_ZOH_E(p2, ts)))                        \
+     - (DISCRETIZE_ZOH_C2(p1, p2, g) * (1.0 + DISCRETIZE_ZOH_E(p1, ts))))
+
+#define DISCRETIZE_ZOH_2POLE_B2(p1, p2, g, ts)                                                  \
+    (((g) * DISCRETIZE_ZOH_E(p1, ts) * DISCRETIZE_ZOH_E(p2, ts))                                \
+     + (DISCRETIZE_ZOH_C1(p1, p2, g) * DISCRETIZE_ZOH_E(p2, ts))                                \
+     + (DISCRETIZE_ZOH_C2(p1, p2, g) * DISCRETIZE_ZOH_E(p1, ts)))
+
+#define DISCRETIZE_ZOH_2POLE_A1(p1, p2, ts)     (-(DISCRETIZE_ZOH_E(p1, ts) + DISCRETIZE_ZOH_E(p2, ts)))
+#define DISCRETIZE_ZOH_2POLE_A2(p1, p2, ts)     (DISCRETIZE_ZOH_E(p1, ts) * DISCRETIZE_ZOH_E(p2, ts))
+
+/*--------- Desired characteristic polynomial z^2 + c1 z + c2 --------------------*/
+
+/** @brief From two real discrete poles. */
+#define DISCRETIZE_POLY_C1(q1, q2)              (-((q1) + (q2)))
+#define DISCRETIZE_POLY_C2(q1, q2)              ((q1) * (q2))
+
+/** @brief From two real continuous poles mapped with z = e^(p ts). */
+#define DISCRETIZE_POLY_S_C1(p1, p2, ts)        DISCRETIZE_POLY_C1(DISCRETIZE_EXP((p1) * (ts)), DISCRETIZE_EXP((p2) * (ts)))
+#define DISCRETIZE_POLY_S_C2(p1, p2, ts)        DISCRETIZE_EXP(((p1) + (p2)) * (ts))
+
+/** @brief From a continuous underdamped pair given by its natural frequency and damping (zeta < 1). */
+#define DISCRETIZE_POLY_WN_C1(wn, zeta, ts)     (-2.0 * DISCRETIZE_EXP(-(zeta) * (wn) * (ts)) * DISCRETIZE_COS((wn) * (ts) * DISCRETIZE_SQRT(1.0 - ((zeta) * (zeta)))))
+#define DISCRETIZE_POLY_WN_C2(wn, zeta, ts)     DISCRETIZE_EXP(-2.0 * (zeta) * (wn) * (ts))
+
+/*--------- Pole placement for a discrete second order state space model ---------
+ *
+ *  x[k+1] = A x[k] + B u[k],  y[k] = C x[k]
+ *
+ *  u = Ko r - K x places the eigenvalues of A - B K at the roots of
+ *  z^2 + c1 z + c2 (Ackermann). The observer
+ *  x^[k+1] = A x^ + B u + L (y - C x^) places A - L C likewise.
+ */
+
+#define DISCRETIZE_PHI_11(a11, a12, a21, a22, c1, c2)   (((a11) * (a11)) + ((a12) * (a21)) + ((c1) * (a11)) + (c2))
+#define DISCRETIZE_PHI_12(a11, a12, a21, a22, c1, c2)   ((a12) * ((a11) + (a22) + (c1)))
+#define DISCRETIZE_PHI_21(a11, a12, a21, a22, c1, c2)   ((a21) * ((a11) + (a22) + (c1)))
+#define DISCRETIZE_PHI_22(a11, a12, a21, a22, c1, c2)   (((a12) * (a21)) + ((a22) * (a22)) + ((c1) * (a22)) + (c2))
+
+#define DISCRETIZE_CTRB_DET(a11, a12, a21, a22, b1, b2) \
+    (((b1) * (((a21) * (b1)) + ((a22) * (b2)))) - ((b2) * (((a11) * (b1)) + ((a12) * (b2)))))
+
+#define DISCRETIZE_OBSV_DET(a11, a12, a21, a22, cc1, cc2) \
+    (((cc1) * (((cc1) * (a12)) + ((cc2) * (a22)))) - ((cc2) * (((cc1) * (a11)) + ((cc2) * (a21)))))
+
+#define DISCRETIZE_ACKERMANN_K1(a11, a12, a21, a22, b1, b2, c1, c2)                             \
+    (((b1) * DISCRETIZE_PHI_21(a11, a12, a21, a22, c1, c2) - (b2) * DISCRETIZE_PHI_11(a11, a12, a21, a22, c1, c2)) \
+     / DISCRETIZE_CTRB_DET(a11, a12, a21, a22, b1, b2))
+
+#define DISCRETIZE_ACKERMANN_K2(a11, a12, a21, a22, b1, b2, c1, c2)                             \
+    (((b1) * DISCRETIZE_PHI_22(a11, a12, a21, a22, c1, c2) - (b2) * DISCRETIZE_PHI_12(a11, a12, a21, a22, c1, c2)) \
+     / DISCRETIZE_CTRB_DET(a11, a12, a21, a22, b1, b2))
+
+#define DISCRETIZE_OBSERVER_L1(a11, a12, a21, a22, cc1, cc2, c1, c2)                            \
+    (((cc1) * DISCRETIZE_PHI_12(a11, a12, a21, a22, c1, c2) - (cc2) * DISCRETIZE_PHI_11(a11, a12, a21, a22, c1, c2)) \
+     / DISCRETIZE_OBSV_DET(a11, a12, a21, a22, cc1, cc2))
+
+#define DISCRETIZE_OBSERVER_L2(a11, a12, a21, a22, cc1, cc2, c1, c2)                            \
+    (((cc1) * DISCRETIZE_PHI_22(a11, a12, a21, a22, c1, c2) - (cc2) * DISCRETIZE_PHI_21(a11, a12, a21, a22, c1, c2)) \
+     / DISCRETIZE_OBSV_DET(a11, a12, a21, a22, cc1, cc2))
+
+/**
+ * @brief Reference gain giving unity DC gain from r to y: 1 / (C (I - A + B K)^-1 B).
+ */
+#define DISCRETIZE_REFERENCE_GAIN(a11, a12, a21, a22, b1, b2, cc1, cc2, k1, k2)                 \
+    ((((1.0 - (a11) + ((b1) * (k1))) * (1.0 - (a22) + ((b2) * (k2))))                           \
+      - ((-(a12) + ((b1) * (k2))) * (-(a21) + ((b2) * (k1)))))                                  \
+     / (((cc1) * (((1.0 - (a22) + ((b2) * (k2))) * (b1)) - ((-(a12) + ((b1) * (k2))) * (b2))))  \
+        + ((cc2) * (((1.0 - (a11) + ((b1) * (k1))) * (b2)) - ((-(a21) + ((b2) * (k1))) * (b1))))))
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* DISCRETIZE_H */
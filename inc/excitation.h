@@ -0,0 +1,161 @@
+/**
+ * @file excitation.h
+ * @author Marcos Dominguez
+ *
+ * @brief Excitation signals for the identification experiments.
+ *
+ * Every signal is generated one sample at a time, so the length of an
+ * experiment does not cost RAM:
+ *
+ * - PRBS: maximal length LFSR of 3 to 32 bits, each bit held a number of
+ *   samples. The LFSR advances 32 bits per refill with word operations.
+ * - Multi-sine: sum of up to EXCITATION_MAX_SINES tones with Schroeder phases,
+ *   which keep the crest factor low.
+ * - Chirp: linear sweep between two frequencies, repeated.
+ *
+ * The output is offset + amplitude * s with s in [-1, 1].
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef EXCITATION_H
+#define EXCITATION_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define EXCITATION_PRBS_MIN_LENGTH  3
+#define EXCITATION_PRBS_MAX_LENGTH  32
+
+#define EXCITATION_MAX_SINES        8
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+typedef enum {
+    EXCITATION_PRBS,
+    EXCITATION_MULTISINE,
+    EXCITATION_CHIRP,
+} excitation_type_t;
+
+/**
+ * @brief State of a PRBS.
+ */
+typedef struct {
+    uint32_t state;             /**< Next length bits of the sequence, oldest in bit 0. */
+    uint32_t taps;              /**< Low terms of the feedback polynomial. */
+    uint32_t word;              /**< Bits generated and not used yet, next in bit 0. */
+    uint8_t length;             /**< Bits of the LFSR, period 2^length - 1. */
+    uint8_t stride;             /**< Bits that can be generated in one step. */
+    uint8_t bits_left;          /**< Bits left in word. */
+    uint16_t hold;              /**< Samples each bit is held. */
+    uint16_t hold_count;        /**< Samples left for the current bit. */
+    float value;                /**< Current output. */
+} excitation_prbs_t;
+
+/**
+ * @brief State of a multi-sine.
+ */
+typedef struct {
+    float phase[EXCITATION_MAX_SINES];  /**< Phase of each tone in rad. */
+    float step[EXCITATION_MAX_SINES];   /**< Phase advance of each tone per sample. */
+    uint8_t count;                      /**< Tones. */
+} excitation_multisine_t;
+
+/**
+ * @brief State of a chirp.
+ */
+typedef struct {
+    float phase;                /**< Phase in rad. */
+    float step_start;           /**< Phase advance per sample at the start of the sweep. */
+    float step_increment;       /**< Change of the phase advance per sample. */
+    uint32_t length;            /**< Samples of a sweep. */
+    uint32_t sample;            /**< Sample within the sweep. */
+} excitation_chirp_t;
+
+/**
+ * @brief Excitation generator.
+ */
+typedef struct {
+    excitation_type_t type;
+    float amplitude;
+    float offset;
+    union {
+        excitation_prbs_t prbs;
+        excitation_multisine_t multisine;
+        excitation_chirp_t chirp;
+    };
+} excitation_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load a maximal length PRBS.
+ *
+ * @param excitation    Instance.
+ * @param length        Bits of the LFSR, EXCITATION_PRBS_MIN_LENGTH to EXCITATION_PRBS_MAX_LENGTH.
+ * @param hold          Samples each bit is held, at least 1. Moves the band of the signal down.
+ * @param seed          Initial state, only the low length bits are used and 0 is replaced by 1.
+ * @param amplitude     Half of the peak to peak value.
+ * @param offset        Middle value.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t EXCITATION_PrbsInit(excitation_t *excitation, uint8_t length, uint16_t hold, uint32_t seed, float amplitude, float offset);
+
+/**
+ * @brief Load a multi-sine. The tones are scaled so the peak never exceeds the amplitude.
+ *
+ * @param excitation    Instance.
+ * @param frequency     Frequency of each tone in Hz.
+ * @param count         Tones, 1 to EXCITATION_MAX_SINES.
+ * @param sample_rate   Sample rate in Hz.
+ * @param amplitude     Peak value around the offset.
+ * @param offset        Middle value.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t EXCITATION_MultisineInit(excitation_t *excitation, const float *frequency, uint8_t count, float sample_rate, float amplitude, float offset);
+
+/**
+ * @brief Load a linear chirp that sweeps from f_start to f_end and starts again.
+ *
+ * @param excitation    Instance.
+ * @param f_start       Start frequency in Hz.
+ * @param f_end         End frequency in Hz.
+ * @param length        Samples of a sweep.
+ * @param sample_rate   Sample rate in Hz.
+ * @param amplitude     Peak value around the offset.
+ * @param offset        Middle value.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t EXCITATION_ChirpInit(excitation_t *excitation, float f_start, float f_end, uint32_t length, float sample_rate, float amplitude, float offset);
+
+/**
+ * @brief Generate the next sample.
+ *
+ * @param excitation    Instance.
+ * @return float        Sample.
+ */
+float EXCITATION_Next(excitation_t *excitation);
+
+/**
+ * @brief Advance a PRBS 32 bits.
+ *
+ * @param prbs          PRBS state.
+ * @return uint32_t     Next 32 bits of the sequence, the oldest in bit 0.
+ */
+uint32_t EXCITATION_PrbsWord(excitation_prbs_t *prbs);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* EXCITATION_H */
@@ -0,0 +1,92 @@
+/**
+ * @file goertzel.h
+ * @author Marcos Dominguez
+ *
+ * @brief Streaming single bin DFT.
+ *
+ * Each sample costs one multiplication and two additions and the filter keeps
+ * only its last two states, so a bin is measured without storing the signal.
+ * The frequency does not need to fall on a DFT bin. Over an integer number of
+ * cycles a constant input does not leak into the result.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef GOERTZEL_H
+#define GOERTZEL_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Goertzel filter of one frequency.
+ */
+typedef struct {
+    float coef;         /**< 2 cos(w). */
+    float cos_w;
+    float sin_w;
+    float s1;           /**< Last state. */
+    float s2;           /**< State before the last one. */
+} goertzel_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the filter for a frequency and clear it.
+ *
+ * @param goertzel      Filter instance.
+ * @param frequency     Frequency to measure, in Hz.
+ * @param sample_rate   Sample rate, in Hz.
+ * @return bool_t       TRUE: Operation success - FALSE: Frequency out of (0, sample_rate / 2).
+ */
+bool_t GOERTZEL_Init(goertzel_t *goertzel, float frequency, float sample_rate);
+
+/**
+ * @brief Clear the states to start a new measurement.
+ *
+ * @param goertzel  Filter instance.
+ */
+void GOERTZEL_Reset(goertzel_t *goertzel);
+
+/**
+ * @brief Add one sample.
+ *
+ * @param goertzel  Filter instance.
+ * @param x         Sample.
+ */
+static inline void GOERTZEL_Update(goertzel_t *goertzel, float x) {
+    float s0 = x + (goertzel->coef * goertzel->s1) - goertzel->s2;
+    goertzel->s2 = goertzel->s1;
+    goertzel->s1 = s0;
+}
+
+/**
+ * @brief Get the bin of the samples added since the last reset.
+ *
+ * The result is sum x[k] e^(-j w k) rotated by e^(j w (N - 1)). The rotation
+ * is the same for every filter of the same frequency fed the same number of
+ * samples, so it cancels in the ratio of two of them.
+ *
+ * @param goertzel  Filter instance.
+ * @param re        Real part.
+ * @param im        Imaginary part.
+ */
+void GOERTZEL_Result(const goertzel_t *goertzel, float *re, float *im);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* GOERTZEL_H */
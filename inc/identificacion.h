@@ -22,8 +22,16 @@ extern "C" {
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
-#define ORDER 2
-#define MAX_SAMPLES 200
+#define ORDER 2             /**< Poles of the model. The numerator gets ORDER + 1 coefficients. */
+#define DEAD_TIME 0         /**< Samples between the input and its first effect on the output. */
+#define NOISE_ORDER 0       /**< Order of the ARMAX noise model, 0 fits an ARX model. RLS only. */
+#define MAX_SAMPLES 400     /**< Samples of a block, each of the two blocks takes 4 bytes per sample. */
+#ifndef IDENTIFICACION_CLOSED_LOOP
+#define IDENTIFICACION_CLOSED_LOOP 0    /**< Run the controller and excite its action, instead of driving the DAC. */
+#endif
+#ifndef IDENTIFICACION_AUTOTUNE
+#define IDENTIFICACION_AUTOTUNE 0       /**< Redesign the running controllers once the fit converges, see autotune.h. Needs IDENTIFICACION_CLOSED_LOOP. */
+#endif
 
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
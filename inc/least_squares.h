@@ -0,0 +1,106 @@
+/**
+ * @file least_squares.h
+ * @author Marcos Dominguez
+ *
+ * @brief Batch least squares through normal equations accumulated one sample at a time.
+ *
+ * Fits theta in y = phi' theta over every sample added. Memory is O(n^2) and
+ * does not depend on the number of samples, and two accumulations over
+ * different samples merge into the fit of both, so a long record can be
+ * split in blocks, windows or threads.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef LEAST_SQUARES_H
+#define LEAST_SQUARES_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define LEAST_SQUARES_MAX_PARAMS    8   /**< Largest parameter vector of an instance. */
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Normal equations PhiT Phi theta = PhiT Y.
+ *
+ * The sums are kept in double so millions of samples do not lose the low
+ * bits, it is n (n + 3) / 2 + 1 multiply-adds per sample.
+ */
+typedef struct {
+    double PhiTPhi[LEAST_SQUARES_MAX_PARAMS][LEAST_SQUARES_MAX_PARAMS];    /**< Upper triangle of PhiT * Phi. */
+    double PhiTY[LEAST_SQUARES_MAX_PARAMS];                                 /**< PhiT * Y. */
+    double YTY;                                                             /**< Y' * Y, for the loss. */
+    uint32_t count;                                                         /**< Samples accumulated. */
+    uint8_t num_params;                                                     /**< Parameters in use. */
+} least_squares_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the instance with no samples.
+ *
+ * @param ls            Instance.
+ * @param num_params    Number of parameters, up to LEAST_SQUARES_MAX_PARAMS.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t LEAST_SQUARES_Init(least_squares_t *ls, uint8_t num_params);
+
+/**
+ * @brief Drop every sample accumulated.
+ *
+ * @param ls            Instance.
+ */
+void LEAST_SQUARES_Reset(least_squares_t *ls);
+
+/**
+ * @brief Accumulate one sample.
+ *
+ * @param ls            Instance.
+ * @param phi           Regressor, num_params values.
+ * @param y             Output.
+ */
+void LEAST_SQUARES_Add(least_squares_t *ls, const float *phi, float y);
+
+/**
+ * @brief Add the samples of another instance with the same number of parameters.
+ *
+ * @param ls            Instance that receives the samples.
+ * @param other         Instance to add.
+ */
+void LEAST_SQUARES_Merge(least_squares_t *ls, const least_squares_t *other);
+
+/**
+ * @brief Solve the normal equations by L D L' without forming the inverse.
+ *
+ * @param ls            Instance.
+ * @param theta         Estimated parameters, num_params values.
+ * @return bool_t       TRUE: Operation success - FALSE: PhiT Phi is singular, the excitation is not rich enough.
+ */
+bool_t LEAST_SQUARES_Solve(const least_squares_t *ls, float *theta);
+
+/**
+ * @brief Sum of the squared residuals of theta over the samples accumulated.
+ *
+ * @param ls            Instance.
+ * @param theta         Parameters.
+ * @return double       Y'Y - 2 theta' PhiT Y + theta' PhiT Phi theta.
+ */
+double LEAST_SQUARES_Loss(const least_squares_t *ls, const float *theta);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* LEAST_SQUARES_H */
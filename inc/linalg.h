@@ -0,0 +1,103 @@
+/**
+ * @file linalg.h
+ * @author Marcos Dominguez
+ *
+ * @brief Small dense linear algebra in single precision.
+ *
+ * Matrices are row-major arrays with the number of columns as stride. Systems
+ * are solved by factorization and substitution, never by forming an inverse:
+ * Cholesky or LDL' for symmetric positive definite systems like the normal
+ * equations, and Householder QR for least squares straight from the
+ * regressors, which does not square the condition number.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef LINALG_H
+#define LINALG_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define LINALG_MAX_COLS     16  /**< Largest number of unknowns of QR. */
+
+/**
+ * @brief Access element (row, col) of a row-major matrix with n columns.
+ */
+#define LINALG_AT(A, n, row, col)   ((A)[(row) * (n) + (col)])
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Factor a symmetric positive definite matrix as L L' in place.
+ *
+ * Only the lower triangle is read. L is left in the lower triangle, the upper
+ * triangle is not modified.
+ *
+ * @param A         n x n matrix.
+ * @param n         Order.
+ * @return bool_t   TRUE: Operation success - FALSE: Matrix not positive definite.
+ */
+bool_t LINALG_CholeskyDecompose(float *A, uint8_t n);
+
+/**
+ * @brief Solve L L' x = b in place with the factor of LINALG_CholeskyDecompose.
+ *
+ * @param L         Factor, n x n.
+ * @param n         Order.
+ * @param b         Right hand side on entry, solution on exit.
+ */
+void LINALG_CholeskySolve(const float *L, uint8_t n, float *b);
+
+/**
+ * @brief Factor a symmetric matrix as L D L' in place, without square roots.
+ *
+ * Only the lower triangle is read. D is left on the diagonal and the unit
+ * lower triangular L below it.
+ *
+ * @param A         n x n matrix.
+ * @param n         Order.
+ * @return bool_t   TRUE: Operation success - FALSE: Zero or negative pivot.
+ */
+bool_t LINALG_LdltDecompose(float *A, uint8_t n);
+
+/**
+ * @brief Solve L D L' x = b in place with the factor of LINALG_LdltDecompose.
+ *
+ * @param LD        Factor, n x n.
+ * @param n         Order.
+ * @param b         Right hand side on entry, solution on exit.
+ */
+void LINALG_LdltSolve(const float *LD, uint8_t n, float *b);
+
+/**
+ * @brief Solve min |A x - b| by Householder QR in place.
+ *
+ * A and b are overwritten by the reflections.
+ *
+ * @param A         rows x cols matrix, rows >= cols.
+ * @param rows      Number of equations.
+ * @param cols      Number of unknowns, up to LINALG_MAX_COLS.
+ * @param b         Right hand side, rows elements.
+ * @param x         Solution, cols elements.
+ * @return bool_t   TRUE: Operation success - FALSE: Rank deficient or bad size.
+ */
+bool_t LINALG_QrLeastSquares(float *A, uint16_t rows, uint8_t cols, float *b, float *x);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* LINALG_H */
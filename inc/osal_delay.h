@@ -4,6 +4,9 @@
  *
  * @brief Manage not blocking delays
  *
+ * The delays count on the 64 bit clock of osal_time, so they have
+ * microsecond resolution and never wrap.
+ *
  * @version 0.1
  * @date 2024-03-15
  */
@@ -19,14 +22,15 @@ extern "C" {
 /*========= [DEPENDENCIES] =====================================================*/
 
 #include "osal_task.h"
+#include "osal_time.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
 typedef struct {
-    osal_tick_t time;
-    osal_tick_t initial_time;
+    osal_time_t time;           /**< Timeout in us. */
+    osal_time_t initial_time;   /**< Start of the count in us. */
     bool_t running;
 } osal_delay_t;
 
@@ -36,10 +40,18 @@ typedef struct {
  * @brief Config delay time and stops counting
  *
  * @param delay delay object
- * @param time  timeout
+ * @param time  timeout in ticks
  */
 void OSAL_DELAY_Config(osal_delay_t *delay, osal_tick_t time);
 
+/**
+ * @brief Config delay time in us and stops counting
+ *
+ * @param delay delay object
+ * @param time_us  timeout in us
+ */
+void OSAL_DELAY_ConfigUs(osal_delay_t *delay, osal_time_t time_us);
+
 /**
  * @brief Reset delay object
  *
@@ -0,0 +1,106 @@
+/**
+ * @file osal_notify.h
+ * @author Marcos Dominguez
+ *
+ * @brief Direct to task notifications.
+ *
+ * Every task owns one 32 bit notification value, so signalling a task needs
+ * no object of its own: no queue, no holder and no creation. Give and Take
+ * use it as a counting semaphore and SetBits and WaitBits as event flags.
+ * Use one of the two ways for each task, they share the value.
+ *
+ * Only the task itself takes or waits, so a notification wakes exactly one
+ * known task. Use osal_semaphore when several tasks wait on the same event.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_NOTIFY_H
+#define _OSAL_NOTIFY_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+#include "osal_task.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define OSAL_NOTIFY_ALL_BITS    0xFFFFFFFFUL    /**< Every bit of the notification value. */
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Increment the notification count of a task, waking it if it waits.
+ *
+ * @param task_ptr          Task to notify, already created.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_NOTIFY_Give(osal_task_t *task_ptr);
+
+/**
+ * @brief Increment the notification count of a task from ISR.
+ *
+ * @param task_ptr          Task to notify, already created.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_NOTIFY_GiveFromISR(osal_task_t *task_ptr, bool_t *yield_need);
+
+/**
+ * @brief Wait for the notification count of the calling task to be non zero and take it.
+ *
+ * @param clear             TRUE: take the whole count, as a binary semaphore - FALSE: take one, as a counting semaphore.
+ * @param wait_time         Maximum time to wait.
+ * @return uint32_t         Count before it was taken, 0 on timeout.
+ */
+uint32_t OSAL_NOTIFY_Take(bool_t clear, osal_tick_t wait_time);
+
+/**
+ * @brief Set bits in the notification value of a task, waking it if it waits.
+ *
+ * @param task_ptr          Task to notify, already created.
+ * @param bits              Bits to set.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_NOTIFY_SetBits(osal_task_t *task_ptr, uint32_t bits);
+
+/**
+ * @brief Set bits in the notification value of a task from ISR.
+ *
+ * @param task_ptr          Task to notify, already created.
+ * @param bits              Bits to set.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_NOTIFY_SetBitsFromISR(osal_task_t *task_ptr, uint32_t bits, bool_t *yield_need);
+
+/**
+ * @brief Wait for a notification of the calling task and read its bits.
+ *
+ * It returns on any notification, the caller checks the bits it needs.
+ *
+ * @param clear_on_entry    Bits cleared before waiting, if no notification is pending.
+ * @param clear_on_exit     Bits cleared after reading them, OSAL_NOTIFY_ALL_BITS to consume all.
+ * @param bits              Pointer where the bits are stored, before clear_on_exit. Can be NULL.
+ * @param wait_time         Maximum time to wait.
+ * @return bool_t           TRUE: Notified - FALSE: Timeout.
+ */
+bool_t OSAL_NOTIFY_WaitBits(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *bits, osal_tick_t wait_time);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* _OSAL_NOTIFY_H */
@@ -0,0 +1,171 @@
+/**
+ * @file osal_pool.h
+ * @author Marcos Dominguez
+ *
+ * @brief Fixed size block pool.
+ *
+ * The free blocks are linked through their own first word, so an alloc or a
+ * free is one pointer swap inside a short critical section, in constant time
+ * and from tasks or ISR. Modules with buffers of variable lifetime share one
+ * pool sized for the peak of all of them instead of reserving each its worst
+ * case.
+ *
+ * The pool counts the blocks in use, the high-water mark and the failed
+ * allocations. With a trace array it also records the caller and the tick of
+ * every allocated block, which finds leaks and rejects double frees.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_POOL_H
+#define _OSAL_POOL_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+#include "osal_task.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/**
+ * @brief Words of storage of a block, every block starts 8 byte aligned.
+ */
+#define OSAL_POOL_BlockWords(data_size)             (((data_size) + sizeof(osal_pool_storage_t) - 1) / sizeof(osal_pool_storage_t))
+
+/**
+ * @brief Length of the osal_pool_storage_t array required for a pool.
+ */
+#define OSAL_POOL_StorageLength(data_size, count)   (OSAL_POOL_BlockWords(data_size) * (count))
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+typedef uint64_t osal_pool_storage_t;  /**< Storage unit, aligns the blocks for any type. */
+
+/**
+ * @brief Record of an allocated block.
+ */
+typedef struct {
+    void *caller;       /**< Return address of the allocation, NULL while free. */
+    osal_tick_t tick;   /**< Tick of the allocation. */
+} osal_pool_trace_t;
+
+/**
+ * @brief Structure to hold a pool.
+ */
+typedef struct {
+    uint8_t *storage;               /**< First block. */
+    uint32_t block_size;            /**< Size of each block in bytes. */
+    uint16_t block_count;           /**< Number of blocks. */
+    uint16_t used;                  /**< Blocks allocated. */
+    uint16_t high_water;            /**< Most blocks allocated at once. */
+    uint32_t failures;              /**< Allocations that found the pool empty. */
+    void *free_list;                /**< First free block. */
+    osal_pool_trace_t *trace;       /**< One record for each block, NULL without tracing. */
+} osal_pool_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the pool struct and free every block.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @param storage           Array of OSAL_POOL_StorageLength(data_size, block_count) elements.
+ * @param data_size         Size of each block, at least a pointer.
+ * @param block_count       Number of blocks.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_POOL_LoadStruct(osal_pool_t *pool_ptr, osal_pool_storage_t *storage, uint32_t data_size, uint16_t block_count);
+
+/**
+ * @brief Record the owner of each block. Call before the first allocation.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @param trace             Array of block_count records, NULL disables the tracing.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail, or blocks are in use.
+ */
+bool_t OSAL_POOL_SetTrace(osal_pool_t *pool_ptr, osal_pool_trace_t *trace);
+
+/**
+ * @brief Take a block.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @return void*            Block, NULL if the pool is empty.
+ */
+void *OSAL_POOL_Alloc(osal_pool_t *pool_ptr);
+
+/**
+ * @brief Give a block back.
+ *
+ * Without trace only a free while no block is in use is caught as a double
+ * free; any other one corrupts the pool.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @param block             Block taken from this pool.
+ * @return bool_t           TRUE: Operation success - FALSE: Not a block of the pool, no block in use, or already free when tracing.
+ */
+bool_t OSAL_POOL_Free(osal_pool_t *pool_ptr, void *block);
+
+/**
+ * @brief Take a block from ISR.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @return void*            Block, NULL if the pool is empty.
+ */
+void *OSAL_POOL_AllocFromISR(osal_pool_t *pool_ptr);
+
+/**
+ * @brief Give a block back from ISR.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @param block             Block taken from this pool.
+ * @return bool_t           TRUE: Operation success - FALSE: Not a block of the pool, or already free when tracing.
+ */
+bool_t OSAL_POOL_FreeFromISR(osal_pool_t *pool_ptr, void *block);
+
+/**
+ * @brief Blocks allocated.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @return uint16_t         Blocks in use.
+ */
+uint16_t OSAL_POOL_Used(const osal_pool_t *pool_ptr);
+
+/**
+ * @brief Most blocks allocated at once since the load or the last reset.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ * @return uint16_t         High-water mark.
+ */
+uint16_t OSAL_POOL_HighWater(const osal_pool_t *pool_ptr);
+
+/**
+ * @brief Start the high-water mark and the failures again from the blocks in use.
+ *
+ * @param pool_ptr          Pointer to the pool.
+ */
+void OSAL_POOL_ResetHighWater(osal_pool_t *pool_ptr);
+
+/**
+ * @brief Record of an allocated block.
+ *
+ * @param pool_ptr                  Pointer to the pool.
+ * @param index                     Block index, from 0 to block_count - 1.
+ * @return const osal_pool_trace_t* Record, NULL without tracing or with a bad index.
+ */
+const osal_pool_trace_t *OSAL_POOL_GetTrace(const osal_pool_t *pool_ptr, uint16_t index);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* _OSAL_POOL_H */
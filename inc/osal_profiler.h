@@ -0,0 +1,141 @@
+/**
+ * @file osal_profiler.h
+ * @author Marcos Dominguez
+ *
+ * @brief Timing instrumentation of periodic loops.
+ *
+ * Call OSAL_PROFILER_Begin at the start of the body of a periodic loop and
+ * OSAL_PROFILER_End before it blocks until the next release. The profiler
+ * keeps min, max, mean and a log2 histogram of the execution time, of the
+ * release jitter and of the response time, and counts the deadline misses.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_PROFILER_H
+#define _OSAL_PROFILER_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+#include "osal_time.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/**
+ * @brief Buckets of the histograms. Bucket 0 holds values under 1 us, bucket b
+ * holds [2^(b-1), 2^b) us and the last one everything above.
+ */
+#define OSAL_PROFILER_BUCKETS   16
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+typedef uint32_t osal_cycles_t;         /**< Duration in cycles. */
+
+/**
+ * @brief Statistics of one measurement, in cycles.
+ */
+typedef struct {
+    osal_cycles_t min;                          /**< Lowest value. */
+    osal_cycles_t max;                          /**< Highest value. */
+    uint64_t sum;                               /**< Sum of the values, for the mean. */
+    uint32_t count;                             /**< Number of values. */
+    uint32_t histogram[OSAL_PROFILER_BUCKETS];  /**< Log2 histogram in us. */
+} osal_profiler_stat_t;
+
+/**
+ * @brief Profiler of a periodic loop.
+ */
+typedef struct {
+    osal_cycles_t period;               /**< Expected period in cycles. */
+    osal_cycles_t deadline;             /**< Deadline from the release in cycles. */
+    uint32_t cycles_per_us;             /**< Scale of the histograms. */
+    osal_time_t next_release;           /**< Expected start of the next iteration. */
+    osal_time_t begin;                  /**< Start of the running iteration. */
+    osal_cycles_t lateness;             /**< Delay of the running iteration from its release. */
+    bool_t started;                     /**< At least one iteration began. */
+    volatile uint32_t sequence;         /**< Odd while the statistics are being updated. */
+    osal_profiler_stat_t execution;     /**< From begin to end. */
+    osal_profiler_stat_t jitter;        /**< Distance from the expected release to begin. */
+    osal_profiler_stat_t response;      /**< From the expected release to end. */
+    uint32_t deadline_misses;           /**< Iterations whose response exceeded the deadline. */
+} osal_profiler_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Start the clock and clear the profiler.
+ *
+ * @param profiler      Profiler instance.
+ * @param period_us     Period of the loop in us.
+ * @param deadline_us   Deadline from each release in us.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_PROFILER_Init(osal_profiler_t *profiler, uint32_t period_us, uint32_t deadline_us);
+
+/**
+ * @brief Clear the statistics and the release reference.
+ *
+ * @param profiler      Profiler instance.
+ */
+void OSAL_PROFILER_Reset(osal_profiler_t *profiler);
+
+/**
+ * @brief Mark the start of an iteration.
+ *
+ * @param profiler      Profiler instance.
+ */
+void OSAL_PROFILER_Begin(osal_profiler_t *profiler);
+
+/**
+ * @brief Mark the end of an iteration.
+ *
+ * @param profiler      Profiler instance.
+ */
+void OSAL_PROFILER_End(osal_profiler_t *profiler);
+
+/**
+ * @brief Copy a consistent snapshot of the profiler from any task.
+ *
+ * The copy is retried a few times while an update is in progress. A task
+ * with a higher priority than the profiled one may have preempted that
+ * update, then it gets FALSE and should try again later.
+ *
+ * @param profiler      Profiler instance.
+ * @param snapshot      Where the copy is stored, not consistent on FALSE.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail, or an update is in progress.
+ */
+bool_t OSAL_PROFILER_Get(const osal_profiler_t *profiler, osal_profiler_t *snapshot);
+
+/**
+ * @brief Mean of a statistic in cycles.
+ *
+ * @param stat              Statistic.
+ * @return osal_cycles_t    Mean, 0 without values.
+ */
+osal_cycles_t OSAL_PROFILER_Mean(const osal_profiler_stat_t *stat);
+
+/**
+ * @brief Convert cycles to us with the scale of a profiler.
+ *
+ * @param profiler      Profiler instance.
+ * @param cycles        Cycles.
+ * @return uint32_t     Microseconds.
+ */
+uint32_t OSAL_PROFILER_CyclesToUs(const osal_profiler_t *profiler, osal_cycles_t cycles);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* _OSAL_PROFILER_H */
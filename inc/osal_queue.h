@@ -35,6 +35,11 @@ extern "C" {
  */
 #define OSAL_QUEUE_StackSize(data_size, queue_length)  (data_size * queue_length)
 
+/**
+ * @brief Calculate the storage of the element pointers of a loan queue, both directions.
+ */
+#define OSAL_QUEUE_LoanIndexSize(queue_length)  OSAL_QUEUE_StackSize(sizeof(void *), 2 * (queue_length))
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
 /**
@@ -48,6 +53,25 @@ typedef struct {
     uint16_t queue_length;              /**< Maximum number of elements the queue can hold. */
 } osal_queue_t;
 
+/**
+ * @brief Structure to hold a queue whose elements are written and read in place.
+ *
+ * The elements live in element_storage and only their addresses move
+ * through the kernel, the free ones in one queue of pointers and the
+ * committed ones in the other. A producer loans a free element, writes it
+ * and commits it; the consumer acquires the oldest committed one, reads it
+ * and releases it. Nothing of data_size is ever copied, and the kernel
+ * still blocks the tasks and orders the elements. Each side may loan or
+ * acquire several elements before giving them back.
+ */
+typedef struct {
+    osal_queue_t filled;                /**< Elements committed, oldest first. */
+    osal_queue_t free;                  /**< Elements that can be loaned. */
+    uint8_t *element_storage;           /**< Pointer to the buffer of queue_length elements. */
+    uint32_t data_size;                 /**< Size of each element. */
+    uint16_t queue_length;              /**< Number of elements. */
+} osal_queue_loan_t;
+
 /*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
 
 /**
@@ -112,6 +136,136 @@ bool_t OSAL_QUEUE_SendFromISR(osal_queue_t *queue_ptr, void *data, bool_t *yield
  */
 bool_t OSAL_QUEUE_ReceiveFromISR(osal_queue_t *queue_ptr, void *const data, bool_t *yield_need);
 
+/**
+ * @brief Send consecutive elements to the queue in one batch.
+ *
+ * Every element that fits is copied inside one critical section, so a task
+ * waiting on the queue wakes once for the whole batch. Only when none fits
+ * the call waits up to wait_time for the first one. One element takes the
+ * path of OSAL_QUEUE_Send. Interrupts stay masked while the batch is copied.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param data              Pointer to the first element, the rest follow it.
+ * @param count             Number of elements.
+ * @param wait_time         Maximum time to wait for the queue to have space.
+ * @return uint16_t         Number of elements sent.
+ */
+uint16_t OSAL_QUEUE_SendN(osal_queue_t *queue_ptr, const void *data, uint16_t count, osal_tick_t wait_time);
+
+/**
+ * @brief Receive up to count elements from the queue in one batch.
+ *
+ * The elements waiting are copied out as OSAL_QUEUE_SendN copies them in.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param data              Pointer to store the elements, room for count of them.
+ * @param count             Maximum number of elements.
+ * @param wait_time         Maximum time to wait for the queue to have data.
+ * @return uint16_t         Number of elements received.
+ */
+uint16_t OSAL_QUEUE_ReceiveN(osal_queue_t *queue_ptr, void *data, uint16_t count, osal_tick_t wait_time);
+
+/**
+ * @brief Send consecutive elements to the queue from ISR inside one critical section.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param data              Pointer to the first element, the rest follow it.
+ * @param count             Number of elements.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return uint16_t         Number of elements sent.
+ */
+uint16_t OSAL_QUEUE_SendNFromISR(osal_queue_t *queue_ptr, const void *data, uint16_t count, bool_t *yield_need);
+
+/**
+ * @brief Receive up to count elements from the queue from ISR inside one critical section.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param data              Pointer to store the elements, room for count of them.
+ * @param count             Maximum number of elements.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return uint16_t         Number of elements received.
+ */
+uint16_t OSAL_QUEUE_ReceiveNFromISR(osal_queue_t *queue_ptr, void *data, uint16_t count, bool_t *yield_need);
+
+/**
+ * @brief Load the loan queue struct with information about its configuration.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param holder_ptr        Pointer to two queue holders.
+ * @param index_storage     Buffer of OSAL_QUEUE_LoanIndexSize(queue_length) bytes for the element pointers.
+ * @param element_storage   Buffer of data_size * queue_length bytes where the elements live.
+ * @param data_size         Size of each element in the queue.
+ * @param queue_length      Maximum number of elements the queue can hold.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_LoanLoadStruct(osal_queue_loan_t *queue_ptr, osal_queue_holder_t *holder_ptr, uint8_t *index_storage, uint8_t *element_storage, uint32_t data_size, uint16_t queue_length);
+
+/**
+ * @brief Create a loan queue with every element free.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @return bool_t           TRUE: Creation success - FALSE: Creation fail.
+ */
+bool_t OSAL_QUEUE_LoanCreate(osal_queue_loan_t *queue_ptr);
+
+/**
+ * @brief Take a free element to write in place.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Pointer to store the address of the element.
+ * @param wait_time         Maximum time to wait for a free element.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_Loan(osal_queue_loan_t *queue_ptr, void **element, osal_tick_t wait_time);
+
+/**
+ * @brief Queue an element taken with OSAL_QUEUE_Loan, once written.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Address of the element.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_Commit(osal_queue_loan_t *queue_ptr, void *element);
+
+/**
+ * @brief Take the oldest committed element to read in place.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Pointer to store the address of the element.
+ * @param wait_time         Maximum time to wait for an element.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_Acquire(osal_queue_loan_t *queue_ptr, const void **element, osal_tick_t wait_time);
+
+/**
+ * @brief Give back an element taken with OSAL_QUEUE_Acquire, once read.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Address of the element.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_Release(osal_queue_loan_t *queue_ptr, const void *element);
+
+/**
+ * @brief Take a free element from ISR.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Pointer to store the address of the element.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_LoanFromISR(osal_queue_loan_t *queue_ptr, void **element, bool_t *yield_need);
+
+/**
+ * @brief Queue a written element from ISR.
+ *
+ * @param queue_ptr         Pointer to structure that hold the information about the queue.
+ * @param element           Address of the element.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_QUEUE_CommitFromISR(osal_queue_loan_t *queue_ptr, void *element, bool_t *yield_need);
+
 #ifdef  __cplusplus
 }
 #endif
@@ -0,0 +1,129 @@
+/**
+ * @file osal_spsc.h
+ * @author Marcos Dominguez
+ *
+ * @brief Lock free single producer single consumer ring buffer.
+ *
+ * The producer only writes the head and the consumer only writes the tail,
+ * so neither side takes a critical section or calls the kernel to move an
+ * element: a push from an ISR costs the copy and two index accesses. The
+ * capacity is a power of 2 and the indices run free, wrapping with the
+ * 32 bit arithmetic, so every slot is usable.
+ *
+ * Optionally a consumer task is notified when a push finds the consumer
+ * caught up, so it can block in OSAL_SPSC_Wait instead of polling. That is
+ * the only kernel call, once per burst and not once per element.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_SPSC_H
+#define _OSAL_SPSC_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+#include "osal_task.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/**
+ * @brief Calculate the storage required for a ring buffer.
+ */
+#define OSAL_SPSC_StorageSize(data_size, capacity)  ((data_size) * (capacity))
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Structure to hold a ring buffer.
+ */
+typedef struct {
+    uint8_t *storage;                   /**< Buffer of capacity elements. */
+    uint32_t data_size;                 /**< Size of each element. */
+    uint32_t mask;                      /**< Capacity - 1. */
+    uint32_t head;                      /**< Elements pushed, written by the producer only. */
+    uint32_t tail;                      /**< Elements popped, written by the consumer only. */
+    osal_task_handler_t consumer;       /**< Task notified when data arrives, NULL for none. */
+} osal_spsc_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the ring buffer struct and empty it.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param storage           Buffer of OSAL_SPSC_StorageSize(data_size, capacity) bytes.
+ * @param data_size         Size of each element.
+ * @param capacity          Maximum number of elements, a power of 2.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_SPSC_LoadStruct(osal_spsc_t *spsc_ptr, uint8_t *storage, uint32_t data_size, uint32_t capacity);
+
+/**
+ * @brief Set the task to notify when data arrives, the one that calls OSAL_SPSC_Wait.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param task_ptr          Consumer task, already created. NULL disables the notification.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_SPSC_SetConsumer(osal_spsc_t *spsc_ptr, osal_task_t *task_ptr);
+
+/**
+ * @brief Push an element from a task. It never blocks.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param data              Pointer to the element.
+ * @return bool_t           TRUE: Element queued - FALSE: Ring full.
+ */
+bool_t OSAL_SPSC_Push(osal_spsc_t *spsc_ptr, const void *data);
+
+/**
+ * @brief Push an element from ISR.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param data              Pointer to the element.
+ * @param yield_need        Pointer where the function report if a change of context is needed.
+ * @return bool_t           TRUE: Element queued - FALSE: Ring full.
+ */
+bool_t OSAL_SPSC_PushFromISR(osal_spsc_t *spsc_ptr, const void *data, bool_t *yield_need);
+
+/**
+ * @brief Pop the oldest element. It never blocks and is safe from ISR.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param data              Pointer to store the element.
+ * @return bool_t           TRUE: Element copied - FALSE: Ring empty.
+ */
+bool_t OSAL_SPSC_Pop(osal_spsc_t *spsc_ptr, void *data);
+
+/**
+ * @brief Block the consumer task until the ring has data.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @param wait_time         Maximum time to wait.
+ * @return bool_t           TRUE: Data available - FALSE: Timeout.
+ */
+bool_t OSAL_SPSC_Wait(osal_spsc_t *spsc_ptr, osal_tick_t wait_time);
+
+/**
+ * @brief Number of elements waiting. Exact from the producer or the consumer.
+ *
+ * @param spsc_ptr          Pointer to the ring buffer.
+ * @return uint32_t         Elements waiting.
+ */
+uint32_t OSAL_SPSC_Count(const osal_spsc_t *spsc_ptr);
+
+#ifdef  __cplusplus
+}
+#endif
+
+#endif  /* _OSAL_SPSC_H */
@@ -0,0 +1,88 @@
+/**
+ * @file osal_time.h
+ * @author Marcos Dominguez
+ *
+ * @brief 64 bit monotonic time base.
+ *
+ * Cycles of the clock of the port and microseconds counted from
+ * OSAL_TIME_Init. Both are 64 bits wide and do not wrap in the life of the
+ * board, so times are compared and subtracted without caring for overflows.
+ * See port_time_freertos.h for the source of the clock.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_TIME_H
+#define _OSAL_TIME_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+
+#if (OS_USED == OS_FREERTOS)
+#include "port_time_freertos.h"
+#endif
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/**
+ * @brief Cycles since OSAL_TIME_Init, from tasks and from ISR.
+ */
+#define OSAL_TIME_GetCycles()       PORT_TIME_GetCycles()
+
+/**
+ * @brief Cycles in one microsecond.
+ */
+#define OSAL_TIME_CyclesPerUs()     PORT_TIME_CyclesPerUs()
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+typedef port_time_t osal_time_t;    /**< Time in cycles or in us. */
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Start the clock. Calls after the first one do nothing.
+ *
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_TIME_Init(void);
+
+/**
+ * @brief Microseconds since OSAL_TIME_Init.
+ *
+ * @return osal_time_t  Microseconds.
+ */
+osal_time_t OSAL_TIME_GetUs(void);
+
+/**
+ * @brief Convert cycles to us, truncating.
+ *
+ * @param cycles        Cycles.
+ * @return osal_time_t  Microseconds.
+ */
+osal_time_t OSAL_TIME_CyclesToUs(osal_time_t cycles);
+
+/**
+ * @brief Convert us to cycles.
+ *
+ * @param us            Microseconds.
+ * @return osal_time_t  Cycles.
+ */
+osal_time_t OSAL_TIME_UsToCycles(osal_time_t us);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* _OSAL_TIME_H */
@@ -0,0 +1,122 @@
+/**
+ * @file osal_timer_wheel.h
+ * @author Marcos Dominguez
+ *
+ * @brief Software timers multiplexed on a single kernel timer by a hashed timing wheel.
+ *
+ * Every wheel timer is a small struct owned by the caller. One periodic
+ * kernel timer turns the wheel every TIMER_WHEEL_TICK_MS and the timers of
+ * the slot it reaches are checked; the ones whose last round came run their
+ * callback from the timer service task. A timer is linked in the slot of its
+ * expiry modulo TIMER_WHEEL_SLOTS with the number of whole turns left, so
+ * start, stop and change period cost the same with hundreds of timers and a
+ * turn only visits the timers of one slot.
+ *
+ * The time resolution is the wheel tick. Callbacks must not block, as with
+ * the kernel timers.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _OSAL_TIMER_WHEEL_H
+#define _OSAL_TIMER_WHEEL_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_global.h"
+#include "osal_timers.h"
+#include "timer_manager.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Structure to hold a timer of the wheel.
+ */
+typedef struct osal_wheel_timer_s {
+    struct osal_wheel_timer_s *next;    /**< Next timer of the slot. */
+    struct osal_wheel_timer_s *prev;    /**< Previous timer of the slot, NULL for the first. */
+    struct osal_wheel_timer_s *expired; /**< Next timer to call back in the running turn. */
+    UtilsCallback_t callback;           /**< Callback function to be executed when the timer expires. */
+    void *context;                      /**< Context for the callback function. */
+    osal_tick_t time;                   /**< Time interval for the timer. */
+    uint32_t rounds;                    /**< Whole turns of the wheel left. */
+    uint16_t slot;                      /**< Slot the timer is linked to. */
+    uint8_t state;                      /**< Stopped, linked to a slot or expired in the running turn. */
+    bool_t repeat;                      /**< Flag indicating whether the timer should repeat. */
+} osal_wheel_timer_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Create and start the kernel timer that turns the wheel.
+ *
+ * Start and ChangePeriod call it, so the wheel turns once the first timer
+ * runs. Calling it at start up only reports early that the kernel timer
+ * could not be created. Calls after the first success do nothing.
+ *
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_TIMER_WHEEL_Init(void);
+
+/**
+ * @brief Load the timer struct, stopped.
+ *
+ * @param timer             Pointer to the timer.
+ * @param time              Time interval for the timer, rounded up to the wheel tick.
+ * @param repeat            Flag indicating whether the timer should repeat.
+ * @param Callback          Callback function to be executed when the timer expires.
+ * @param context           Context for the callback function.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_TIMER_WHEEL_LoadStruct(osal_wheel_timer_t *timer, osal_tick_t time, bool_t repeat, UtilsCallback_t Callback, void *context);
+
+/**
+ * @brief Start a timer, or start it again from now if it was running.
+ *
+ * @param timer             Pointer to the timer.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail, or the wheel could not be started.
+ */
+bool_t OSAL_TIMER_WHEEL_Start(osal_wheel_timer_t *timer);
+
+/**
+ * @brief Stop a timer. A stopped timer is not called back.
+ *
+ * @param timer             Pointer to the timer.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_TIMER_WHEEL_Stop(osal_wheel_timer_t *timer);
+
+/**
+ * @brief Change the time interval of a timer and start it from now.
+ *
+ * @param timer             Pointer to the timer.
+ * @param time              New time interval.
+ * @return bool_t           TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t OSAL_TIMER_WHEEL_ChangePeriod(osal_wheel_timer_t *timer, osal_tick_t time);
+
+/**
+ * @brief Whether the timer is running.
+ *
+ * @param timer             Pointer to the timer.
+ * @return bool_t           TRUE: Running - FALSE: Stopped.
+ */
+bool_t OSAL_TIMER_WHEEL_IsActive(osal_wheel_timer_t *timer);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* _OSAL_TIMER_WHEEL_H */
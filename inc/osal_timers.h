@@ -27,8 +27,6 @@ extern "C" {
 #include "data_types.h"
 /// \endcond
 
-#include "timer_manager.h"
-
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
 /**
@@ -46,6 +44,11 @@ extern "C" {
  */
 #define OSAL_TIMERS_Stop(timer)     PORT_TIMERS_Stop(((osal_timer_t *)(timer))->handler)
 
+/**
+ * @brief Macro to change the period of a timer, starting it if it was stopped.
+ */
+#define OSAL_TIMERS_ChangePeriod(timer, time)   PORT_TIMERS_ChangePeriod(((osal_timer_t *)(timer))->handler, (time))
+
 
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
@@ -96,11 +99,13 @@ bool_t OSAL_TIMERS_LoadStruct(osal_timer_t *timer, char *name, osal_tick_t time,
 /**
  * @brief Create a timer.
  *
+ * The callback is reached through the timer itself, so the struct must
+ * outlive the timer.
+ *
  * @param timer             Pointer to structure that hold the information about the timer.
- * @param index             Timer index.
  * @return bool_t           TRUE: Creation success - FALSE: Creation fail.
  */
-bool_t OSAL_TIMERS_Create(osal_timer_t *timer, timer_index_t index);
+bool_t OSAL_TIMERS_Create(osal_timer_t *timer);
 
 #ifdef  __cplusplus
 }
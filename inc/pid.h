@@ -13,18 +13,99 @@
 
 /*========= [DEPENDENCIES] =====================================================*/
 
-#include <stdint.h>
+#include "biquad.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
+#define PID_NUM_STAGES  1
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
+/**
+ * @brief Coefficients of the controller, swapped as a whole while it runs.
+ *
+ * The error is reference_weight * r - y and the output of the cascade is
+ * shifted left gain_shift bits, so numerators with gains above the Q2.30
+ * range are stored divided by 2^gain_shift.
+ */
+typedef struct {
+    int32_t coefs[PID_NUM_STAGES * BIQUAD_COEFS_PER_STAGE];    /**< Sections in Q2.30. */
+    uint8_t gain_shift;                                         /**< Left shift of the output. */
+    uint8_t reference_weight;                                   /**< Weight of the reference in the error. */
+} pid_tuning_t;
+
+/**
+ * @brief One controller: its cascade, the state of the cascade and the active tuning.
+ *
+ * The filter points at the state of the same instance, so an instance is
+ * set up with PID_ControllerInit and not copied afterwards.
+ */
+typedef struct {
+    const pid_tuning_t *tuning;                                 /**< Active coefficients, swapped atomically. */
+    int32_t state[PID_NUM_STAGES * BIQUAD_STATE_PER_STAGE];     /**< State of the cascade in Q31. */
+    biquad_t filter;                                            /**< Cascade run on the active coefficients. */
+} pid_controller_t;
+
 /*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
 
+/**
+ * @brief Load a controller with a tuning and clear its state.
+ *
+ * @param pid       Controller instance.
+ * @param tuning    Coefficients, NULL loads the built-in ones.
+ * @return bool_t   TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t PID_ControllerInit(pid_controller_t *pid, const pid_tuning_t *tuning);
+
+/**
+ * @brief Clear the state of a controller, the tuning is kept.
+ *
+ * @param pid       Controller instance.
+ */
+void PID_ControllerReset(pid_controller_t *pid);
+
+/**
+ * @brief Run one Q15 sample through the cascade of a controller.
+ *
+ * @param pid       Controller instance.
+ * @param input     Input signal in Q15 format.
+ * @return int32_t  Filtered output signal in Q15 format.
+ */
+int32_t PID_ControllerFilter(pid_controller_t *pid, int32_t input);
+
+/**
+ * @brief Run a block of Q15 samples through the cascade of a controller.
+ *
+ * @param pid       Controller instance.
+ * @param input     Input samples in Q15 format.
+ * @param output    Filtered output samples in Q15 format, may be the input buffer.
+ * @param size      Number of samples.
+ */
+void PID_ControllerFilterBlock(pid_controller_t *pid, const int32_t *input, int32_t *output, size_t size);
+
+/**
+ * @brief Run one sample of a controller on the error of its active tuning.
+ *
+ * @param pid       Controller instance.
+ * @param reference Reference in Q15 format.
+ * @param output    Measured output in Q15 format.
+ * @return int32_t  Control action in Q15 format.
+ */
+int32_t PID_ControllerStep(pid_controller_t *pid, int32_t reference, int32_t output);
+
+/**
+ * @brief Publish new coefficients to a running controller, as PID_SetTuning.
+ *
+ * @param pid       Controller instance.
+ * @param tuning    Coefficients, NULL restores the built-in ones.
+ */
+void PID_ControllerSetTuning(pid_controller_t *pid, const pid_tuning_t *tuning);
+
 /**
  * @brief Resets the filter state.
  *
- * This function resets the internal state of the filter buffers.
+ * This function resets the internal state of the filter buffers. This and
+ * the functions below run the default controller of the module.
  */
 int32_t PID_Reset(void);
 
@@ -32,12 +113,44 @@ int32_t PID_Reset(void);
  * @brief Filters input signal using a digital filter.
  *
  * This function implements a digital filter to process the input signal. It takes
- * the input signal in Q15 format and applies a numerator-denominator filter with
- * coefficients provided as Q15 fixed-point values.
+ * the input signal in Q15 format and runs it through a cascade of second order
+ * sections with Q2.30 coefficients and Q31 state.
  *
  * @param input Input signal in Q15 format.
  * @return Filtered output signal in Q15 format.
  */
 int32_t PID_Filter(int32_t input);
 
+/**
+ * @brief Filters a block of samples using the same filter as PID_Filter.
+ *
+ * Gives the same result as calling PID_Filter for every sample, without the
+ * per-sample call overhead. Input and output may be the same buffer.
+ *
+ * @param input  Input samples in Q15 format.
+ * @param output Filtered output samples in Q15 format.
+ * @param size   Number of samples.
+ */
+void PID_FilterBlock(const int32_t *input, int32_t *output, size_t size);
+
+/**
+ * @brief Run one sample of the controller on the error of the active tuning.
+ *
+ * @param reference Reference in Q15 format.
+ * @param output    Measured output in Q15 format.
+ * @return int32_t  Control action in Q15 format.
+ */
+int32_t PID_Step(int32_t reference, int32_t output);
+
+/**
+ * @brief Publish new coefficients to the running controller.
+ *
+ * The pointer is published atomically and the next sample uses the whole
+ * new set, the filter state is kept. The tuning must stay unchanged while it
+ * is active and for one sample after it is replaced.
+ *
+ * @param tuning    Coefficients, NULL restores the built-in ones.
+ */
+void PID_SetTuning(const pid_tuning_t *tuning);
+
 #endif  /* PID_H */
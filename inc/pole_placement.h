@@ -0,0 +1,49 @@
+/**
+ * @file pole_placement.h
+ * @author Marcos Dominguez
+ *
+ * @brief State feedback and Luenberger observer for the second order plant of the rig.
+ *
+ * Instance of the state space kernels with two states, one input and one
+ * output. It provides pole_placement_model_t, pole_placement_gain_t and
+ * pole_placement_t, and POLE_PLACEMENT_Init, _Control, _Output, _Predict,
+ * _Correct and _Update. See state_space_template.h.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef POLE_PLACEMENT_H
+#define POLE_PLACEMENT_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "state_space.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define POLE_PLACEMENT_STATES   2
+#define POLE_PLACEMENT_INPUTS   1
+#define POLE_PLACEMENT_OUTPUTS  1
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+#define STATE_SPACE_NAME        pole_placement
+#define STATE_SPACE_PREFIX      POLE_PLACEMENT
+#define STATE_SPACE_STATES      POLE_PLACEMENT_STATES
+#define STATE_SPACE_INPUTS      POLE_PLACEMENT_INPUTS
+#define STATE_SPACE_OUTPUTS     POLE_PLACEMENT_OUTPUTS
+#include "state_space_template.h"
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* POLE_PLACEMENT_H */
@@ -29,6 +29,7 @@ typedef TickType_t port_tick_t; /**< Type definition for the FreeRTOS tick type.
 
 #define OSAL_MAX_DELAY             portMAX_DELAY                    /**< Maximum delay value for OSAL functions (wait forever). */
 #define OSAL_MS_TO_TICKS(ms)       pdMS_TO_TICKS(ms)                /**< Macro to convert milliseconds to ticks. */
+#define OSAL_TICK_PERIOD_US        (1000000UL / configTICK_RATE_HZ) /**< Length of a tick in us. */
 #define OSAL_ConfigASSERT(x)       configASSERT(x)                  /**< Macro to assert a configuration condition (block). */
 #define OSAL_ATOMIC_TASK_SIZE      configMINIMAL_STACK_SIZE         /**< Size of the stack for atomic tasks. */
 #define OSAL_PORT_YIELD(condition) portEND_SWITCHING_ISR(condition) /**< Macro to yield from an ISR. */
@@ -20,8 +20,10 @@ extern "C" {
 #include "port_freertos.h"
 #ifndef TEST
 #include "queue.h"
+#include "task.h"
 #else
 #include "FreeRTOS_queue_simulated.h"
+#include "FreeRTOS_task_simulated.h"
 #endif
 /// \cond
 #include "data_types.h"
@@ -103,6 +105,63 @@ bool_t PORT_QUEUE_SendFromISR(osal_queue_handle_t handler, void *data, bool_t *y
  */
 bool_t PORT_QUEUE_ReceiveFromISR(osal_queue_handle_t handler, void *data, bool_t *yield_need);
 
+/**
+ * @brief Send consecutive items to a queue inside one critical section.
+ *
+ * The items that fit are copied with the interrupt safe primitives inside
+ * one critical section, and the caller yields once if a task was woken.
+ * Only when none fits the first one waits up to wait_time, and the rest
+ * follow without blocking. One item goes straight to PORT_QUEUE_Send.
+ *
+ * @param handler   The handle of the queue.
+ * @param data      The pointer to the first item.
+ * @param data_size The size of each item.
+ * @param count     The number of items.
+ * @param wait_time The wait time in ticks.
+ *
+ * @return The number of items sent.
+ */
+uint16_t PORT_QUEUE_SendN(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, port_tick_t wait_time);
+
+/**
+ * @brief Receive consecutive items from a queue inside one critical section.
+ *
+ * @param handler   The handle of the queue.
+ * @param data      The pointer to store the items.
+ * @param data_size The size of each item.
+ * @param count     The maximum number of items.
+ * @param wait_time The wait time in ticks for the first item.
+ *
+ * @return The number of items received.
+ */
+uint16_t PORT_QUEUE_ReceiveN(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, port_tick_t wait_time);
+
+/**
+ * @brief Send consecutive items to a queue from an ISR inside one critical section.
+ *
+ * @param handler    The handle of the queue.
+ * @param data       The pointer to the first item.
+ * @param data_size  The size of each item.
+ * @param count      The number of items.
+ * @param yield_need The pointer to a flag indicating if a context switch is needed.
+ *
+ * @return The number of items sent.
+ */
+uint16_t PORT_QUEUE_SendNFromISR(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, bool_t *yield_need);
+
+/**
+ * @brief Receive consecutive items from a queue from an ISR inside one critical section.
+ *
+ * @param handler    The handle of the queue.
+ * @param data       The pointer to store the items.
+ * @param data_size  The size of each item.
+ * @param count      The maximum number of items.
+ * @param yield_need The pointer to a flag indicating if a context switch is needed.
+ *
+ * @return The number of items received.
+ */
+uint16_t PORT_QUEUE_ReceiveNFromISR(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, bool_t *yield_need);
+
 #ifdef __cplusplus
 }
 
@@ -24,6 +24,12 @@ extern "C" {
 #include "FreeRTOS_task_simulated.h"
 #endif
 
+#include "port_freertos.h"
+
+/// \cond
+#include "data_types.h"
+/// \endcond
+
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
 #define OSAL_TASK_Delay(delay_ticks) vTaskDelay(delay_ticks) /**< Macro to delay the task by the specified number of ticks. */
@@ -34,8 +40,18 @@ extern "C" {
 
 #define OSAL_TASK_GetTickCount() xTaskGetTickCount() /**< Macro to get the current tick count. */
 
+#define OSAL_TASK_GetTickCountFromISR() xTaskGetTickCountFromISR() /**< Macro to get the current tick count from an ISR. */
+
 #define OSAL_TASK_GetTaskName(X) pcTaskGetTaskName(X) /**< Macro to get the name of a task. */
 
+#define OSAL_TASK_EnterCritical() taskENTER_CRITICAL() /**< Macro to mask the kernel aware interrupts, from a task only. */
+
+#define OSAL_TASK_ExitCritical() taskEXIT_CRITICAL() /**< Macro to leave the section opened by OSAL_TASK_EnterCritical. */
+
+#define OSAL_TASK_EnterCriticalFromISR() taskENTER_CRITICAL_FROM_ISR() /**< Macro to mask the kernel aware interrupts from an ISR, returns the mask to restore. */
+
+#define OSAL_TASK_ExitCriticalFromISR(mask) taskEXIT_CRITICAL_FROM_ISR(mask) /**< Macro to restore the mask returned by OSAL_TASK_EnterCriticalFromISR. */
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
 typedef TaskHandle_t osal_task_handler_t; /**< Type definition for the FreeRTOS task handle. */
@@ -65,6 +81,58 @@ typedef TaskFunction_t OSAL_TASK_Callback_t; /**< Type definition for the task c
  */
 osal_task_handler_t PORT_TASK_CreateStaticTask(OSAL_TASK_Callback_t function, char *name, uint16_t size, void *context, uint8_t priority, osal_stack_holder_t *stack_ptr, osal_task_holder_t *task_hold_ptr);
 
+/**
+ * @brief Increment the notification count of a task, waking it if it waits.
+ *
+ * @param handler       The handle of the task to notify.
+ */
+void PORT_TASK_NotifyGive(osal_task_handler_t handler);
+
+/**
+ * @brief Increment the notification count of a task from ISR.
+ *
+ * @param handler       The handle of the task to notify.
+ * @param yield_need    Pointer where the function report if a change of context is needed.
+ */
+void PORT_TASK_NotifyGiveFromISR(osal_task_handler_t handler, bool_t *yield_need);
+
+/**
+ * @brief Wait for the notification count of the calling task to be non zero and take it.
+ *
+ * @param clear         TRUE: clear the count - FALSE: decrement it.
+ * @param wait_time     Maximum time to wait.
+ * @return uint32_t     Count before it was taken, 0 on timeout.
+ */
+uint32_t PORT_TASK_NotifyTake(bool_t clear, port_tick_t wait_time);
+
+/**
+ * @brief Set bits in the notification value of a task, waking it if it waits.
+ *
+ * @param handler       The handle of the task to notify.
+ * @param bits          Bits to set.
+ */
+void PORT_TASK_NotifySetBits(osal_task_handler_t handler, uint32_t bits);
+
+/**
+ * @brief Set bits in the notification value of a task from ISR.
+ *
+ * @param handler       The handle of the task to notify.
+ * @param bits          Bits to set.
+ * @param yield_need    Pointer where the function report if a change of context is needed.
+ */
+void PORT_TASK_NotifySetBitsFromISR(osal_task_handler_t handler, uint32_t bits, bool_t *yield_need);
+
+/**
+ * @brief Wait for a notification of the calling task and read its value.
+ *
+ * @param clear_on_entry    Bits cleared before waiting, if no notification is pending.
+ * @param clear_on_exit     Bits cleared after reading the value.
+ * @param bits              Pointer where the value is stored, before clear_on_exit. Can be NULL.
+ * @param wait_time         Maximum time to wait.
+ * @return bool_t           TRUE: Notified - FALSE: Timeout.
+ */
+bool_t PORT_TASK_NotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *bits, port_tick_t wait_time);
+
 #ifdef __cplusplus
 }
 
@@ -0,0 +1,69 @@
+/**
+ * @file port_time_freertos.h
+ * @author Marcos Dominguez
+ *
+ * @brief Port for the 64 bit monotonic clock.
+ *
+ * On the LPC4337 the 32 bit counter of the repetitive interrupt timer runs
+ * at the core clock and its match at 0xFFFFFFFF counts the overflows, which
+ * make the high word. sAPI owns the interrupts of TIMER0 to TIMER3, the RIT
+ * is free. At 204 MHz the count wraps after 2800 years.
+ *
+ * On the host a cycle is a nanosecond. The ticks of the simulated scheduler
+ * give the time, so delays and releases follow the virtual time, and
+ * CLOCK_MONOTONIC gives the time elapsed inside the running tick, clamped
+ * below one tick, so execution times keep the host resolution.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef _PORT_TIME_FREERTOS_H
+#define _PORT_TIME_FREERTOS_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "port_freertos.h"
+
+/// \cond
+#include "utils.h"
+#include "data_types.h"
+/// \endcond
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+typedef uint64_t port_time_t; /**< Type of a cycle count. */
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Start the clock. Calls after the first one do nothing.
+ */
+void PORT_TIME_Init(void);
+
+/**
+ * @brief Cycles since PORT_TIME_Init, from tasks and from ISR.
+ *
+ * @return port_time_t  Cycles.
+ */
+port_time_t PORT_TIME_GetCycles(void);
+
+/**
+ * @brief Cycles in one microsecond.
+ *
+ * @return uint32_t     Cycles per microsecond.
+ */
+uint32_t PORT_TIME_CyclesPerUs(void);
+
+#ifdef __cplusplus
+}
+
+#endif
+
+#endif /* _PORT_TIME_FREERTOS_H */
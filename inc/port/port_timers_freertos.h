@@ -28,7 +28,6 @@ extern "C" {
 #include "utils.h"
 #include "data_types.h"
 /// \endcond
-#include "timer_manager.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
@@ -59,6 +58,17 @@ extern "C" {
  */
 #define PORT_TIMERS_Stop(handler)  xTimerStop(((port_timers_handler_t)(handler)), 50)
 
+/**
+ * @brief Changes the period of a FreeRTOS timer.
+ *
+ * This macro calls xTimerChangePeriod with a timeout of 50 ticks. Like
+ * FreeRTOS does, it also starts the timer if it was stopped.
+ *
+ * @param handler The handle of the timer.
+ * @param time    The new period in ticks.
+ */
+#define PORT_TIMERS_ChangePeriod(handler, time) xTimerChangePeriod(((port_timers_handler_t)(handler)), (time), 50)
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
 typedef StaticTimer_t port_timers_holder_t;  /**< Type definition for the static timer holder. */
@@ -81,17 +91,17 @@ typedef struct {
  * @brief Create a FreeRTOS timer.
  *
  * This function creates a FreeRTOS timer with the provided name, time period, and callback function.
+ * The callback is kept as the ID of the timer, so it must outlive the timer.
  *
  * @param name       The name of the timer.
  * @param time       The period of the timer in ticks.
  * @param repeat     Whether the timer should repeat or not.
  * @param Callback   The callback function to be executed when the timer expires.
  * @param holder_ptr The pointer to the timer holder.
- * @param index      The index of the timer in the timers_active array.
  *
  * @return The handle of the created timer.
  */
-port_timers_handler_t PORT_TIMER_Create(const char *name, port_tick_t time, bool_t repeat, PortSWTimerCallback_t *Callback, port_timers_holder_t *holder_ptr, timer_index_t index);
+port_timers_handler_t PORT_TIMER_Create(const char *name, port_tick_t time, bool_t repeat, PortSWTimerCallback_t *Callback, port_timers_holder_t *holder_ptr);
 
 #ifdef __cplusplus
 }
@@ -12,6 +12,7 @@
 
 #include <string.h>
 #include "FreeRTOS_queue_simulated.h"
+#include "FreeRTOS_task_simulated.h"
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
@@ -26,6 +27,17 @@
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
+/**
+ * @brief Let the other tasks run for a tick while a task waits on a queue.
+ *
+ * Only tasks of the virtual time scheduler block, anything else returns at
+ * once as before.
+ *
+ * @param wait_time Ticks left to wait, decremented unless it is portMAX_DELAY.
+ * @return bool_t TRUE if a tick went by, FALSE if the wait is over.
+ */
+static bool_t WaitTick(TickType_t *wait_time);
+
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
@@ -69,6 +81,8 @@ QueueHandle_t __attribute__((weak)) xQueueCreateStatic(const UBaseType_t queue_l
 }
 
 UBaseType_t __attribute__((weak)) xQueueSend(QueueHandle_t handler, void *data, TickType_t wait_time) {
+    while ((handler->used_elements >= handler->queue_length) && WaitTick(&wait_time)) {
+    }
     if (queue_send_success) {
         if ((handler->used_elements < handler->queue_length)) {
             memcpy(handler->push_ptr, data, handler->data_size);
@@ -90,6 +104,8 @@ UBaseType_t __attribute__((weak)) xQueueSend(QueueHandle_t handler, void *data,
 }
 
 UBaseType_t __attribute__((weak)) xQueueReceive(QueueHandle_t handler, void *data, TickType_t wait_time) {
+    while ((handler->used_elements == 0) && WaitTick(&wait_time)) {
+    }
     if (queue_receive_success) {
         if ((handler->used_elements > 0) && (data != NULL)) {
             memcpy(data, handler->pop_ptr, handler->data_size);
@@ -157,4 +173,17 @@ BaseType_t __attribute__((weak)) xQueueReceiveFromISR(QueueHandle_t handler, voi
 
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
+static bool_t WaitTick(TickType_t *wait_time) {
+    bool_t ret = FALSE;
+    if ((*wait_time > 0) && Task_Simulated_Running()) {
+        if (*wait_time != portMAX_DELAY) {
+            (*wait_time)--;
+        }
+        vTaskDelay(1);
+        ret = TRUE;
+    }
+
+    return ret;
+}
+
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
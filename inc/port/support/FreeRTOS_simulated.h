@@ -34,6 +34,8 @@ typedef int32_t BaseType_t; /**< Type for base values in FreeRTOS. */
 
 #define portMAX_DELAY                     ((TickType_t) 0xFFFFFFFF) /**< Maximum time delay value (wait forever). */
 
+#define configTICK_RATE_HZ                ((TickType_t) 1000) /**< Ticks per second, pdMS_TO_TICKS assumes 1 ms. */
+
 #define pdMS_TO_TICKS(ms)                 (ms) /**< Macro to convert milliseconds to ticks. */
 
 #define configASSERT(x)                   if ((x) == 0) {printf("%s - line: %d\n", __FILE__, __LINE__); return FALSE;}
@@ -11,15 +11,54 @@
 /*========= [DEPENDENCIES] =====================================================*/
 
 #include "FreeRTOS_task_simulated.h"
+#include <stdlib.h>
+#include <ucontext.h>
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
+#define TICK_BEFORE(a, b)           ((int32_t)((a) - (b)) < 0)  /**< Wrap safe a < b */
+
+#define SIMULATED_TASK_STACK_SIZE   (64U * 1024U)   /**< Host stack of each task, printf needs far more than the target stack */
+
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
+/**
+ * @brief Host context of a task of the scheduler.
+ */
+typedef struct {
+    ucontext_t context;                         /**< Registers saved while the task is blocked */
+    uint8_t stack[SIMULATED_TASK_STACK_SIZE];   /**< Host stack of the task */
+} coroutine_t;
+
 /*========= [TASK DECLARATIONS] ================================================*/
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
+/**
+ * @brief Insert a task in the scheduler list ordered by wake tick, priority and sequence.
+ */
+static void ListInsert(StaticTask_t *task);
+
+/**
+ * @brief Remove a task from the scheduler list if it is there.
+ */
+static void ListRemove(StaticTask_t *task);
+
+/**
+ * @brief Entry point of every coroutine, it runs the body of the task forever.
+ */
+static void TaskEntry(void);
+
+/**
+ * @brief Block the running task until a tick and go back to the scheduler.
+ */
+static void BlockRunningTask(TickType_t wake_tick);
+
+/**
+ * @brief Move a task blocked in ulTaskNotifyTake or xTaskNotifyWait to the current tick.
+ */
+static void WakeNotified(StaticTask_t *task);
+
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
@@ -32,14 +71,34 @@ uint32_t so_tick_count = 0; /**< Counter used for simulated tick count. */
 
 char *simulated_task_name; /**< Simulated task name. */
 
+static StaticTask_t *task_list = NULL; /**< Tasks of the scheduler, the next to run first. */
+
+static StaticTask_t *running_task = NULL; /**< Task running inside Task_Simulated_RunUntil. */
+
+static uint32_t task_sequence = 0; /**< Creation counter. */
+
+static ucontext_t scheduler_context; /**< Context of Task_Simulated_RunUntil while a task runs. */
+
+static uint32_t scheduler_suspended = 0; /**< Nesting of vTaskSuspendAll. */
+
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
 TaskHandle_t __attribute__((weak)) xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *const pcName, const uint32_t ulStackDepth, void *const pvParameters, UBaseType_t uxPriority, StackType_t *const puxStackBuffer, StaticTask_t *const pxTaskBuffer) {
     if (task_create_success) {
+        ListRemove(pxTaskBuffer);
         pxTaskBuffer->TaskCallback = pxTaskCode;
         pxTaskBuffer->context = pvParameters;
+        pxTaskBuffer->priority = uxPriority;
+        pxTaskBuffer->wake_tick = so_tick_count;
+        pxTaskBuffer->sequence = task_sequence++;
+        pxTaskBuffer->delayed = FALSE;
+        pxTaskBuffer->notify_waiting = FALSE;
+        pxTaskBuffer->notify_pending = FALSE;
+        pxTaskBuffer->notify_value = 0;
+        pxTaskBuffer->coroutine = NULL;
+        ListInsert(pxTaskBuffer);
         if (handler_to_save != NULL) {
             *handler_to_save = pxTaskBuffer;
             handler_to_save = NULL;
@@ -56,12 +115,129 @@ TickType_t __attribute__((weak)) xTaskGetTickCount(void) {
     return so_tick_count;
 }
 
+TickType_t __attribute__((weak)) xTaskGetTickCountFromISR(void) {
+    return so_tick_count;
+}
+
 void __attribute__((weak)) vTaskDelay(TickType_t delay_ticks) {
-    so_tick_count += delay_ticks;
+    if (running_task != NULL) {
+        BlockRunningTask(so_tick_count + delay_ticks);
+    }
+    else {
+        so_tick_count += delay_ticks;
+    }
 }
 
 void __attribute__((weak)) vTaskDelayUntil(TickType_t *previous_time, TickType_t delay_ticks) {
-    so_tick_count += delay_ticks;
+    if (running_task != NULL) {
+        *previous_time += delay_ticks;
+        if (TICK_BEFORE(so_tick_count, *previous_time)) {
+            BlockRunningTask(*previous_time);
+        }
+        else {
+            running_task->delayed = TRUE;   /* Already late, FreeRTOS returns without blocking */
+        }
+    }
+    else {
+        so_tick_count += delay_ticks;
+    }
+}
+
+void __attribute__((weak)) vTaskSuspendAll(void) {
+    scheduler_suspended++;
+}
+
+BaseType_t __attribute__((weak)) xTaskResumeAll(void) {
+    if (scheduler_suspended > 0) {
+        scheduler_suspended--;
+    }
+    return pdFALSE;
+}
+
+BaseType_t __attribute__((weak)) xTaskNotifyGive(TaskHandle_t xTaskToNotify) {
+    return xTaskNotify(xTaskToNotify, 0, eIncrement);
+}
+
+void __attribute__((weak)) vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken) {
+    xTaskNotifyFromISR(xTaskToNotify, 0, eIncrement, pxHigherPriorityTaskWoken);
+}
+
+BaseType_t __attribute__((weak)) xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction) {
+    BaseType_t ret = pdPASS;
+    switch (eAction) {
+        case eSetBits:
+            xTaskToNotify->notify_value |= ulValue;
+            break;
+        case eIncrement:
+            xTaskToNotify->notify_value++;
+            break;
+        case eSetValueWithOverwrite:
+            xTaskToNotify->notify_value = ulValue;
+            break;
+        case eSetValueWithoutOverwrite:
+            if (xTaskToNotify->notify_pending) {
+                ret = pdFAIL;
+            }
+            else {
+                xTaskToNotify->notify_value = ulValue;
+            }
+            break;
+        default:
+            break;
+    }
+    xTaskToNotify->notify_pending = TRUE;
+    WakeNotified(xTaskToNotify);
+    return ret;
+}
+
+BaseType_t __attribute__((weak)) xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken) {
+    *pxHigherPriorityTaskWoken = xTaskToNotify->notify_waiting ? pdTRUE : pdFALSE;
+    return xTaskNotify(xTaskToNotify, ulValue, eAction);
+}
+
+BaseType_t __attribute__((weak)) xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait) {
+    BaseType_t ret = pdFALSE;
+    StaticTask_t *task = running_task;
+    if (task != NULL) {
+        if (!task->notify_pending) {
+            task->notify_value &= ~ulBitsToClearOnEntry;
+            if (xTicksToWait > 0) {
+                task->notify_waiting = TRUE;
+                BlockRunningTask(so_tick_count + ((xTicksToWait == portMAX_DELAY) ? 0x7FFFFFFFU : xTicksToWait));
+                task->notify_waiting = FALSE;
+            }
+        }
+        if (pulNotificationValue != NULL) {
+            *pulNotificationValue = task->notify_value;
+        }
+        if (task->notify_pending) {
+            task->notify_value &= ~ulBitsToClearOnExit;
+            ret = pdTRUE;
+        }
+        task->notify_pending = FALSE;
+    }
+
+    return ret;
+}
+
+uint32_t __attribute__((weak)) ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait) {
+    uint32_t ret = 0;
+    StaticTask_t *task = running_task;
+    if (task != NULL) {
+        if ((task->notify_value == 0) && (xTicksToWait > 0)) {
+            task->notify_waiting = TRUE;
+            /* Forever is half the tick range ahead, the farthest TICK_BEFORE orders */
+            BlockRunningTask(so_tick_count + ((xTicksToWait == portMAX_DELAY) ? 0x7FFFFFFFU : xTicksToWait));
+            task->notify_waiting = FALSE;
+        }
+        ret = task->notify_value;
+        if (ret > 0) {
+            task->notify_value = (xClearCountOnExit != pdFALSE) ? 0 : (ret - 1);
+        }
+        task->notify_pending = FALSE;
+    }
+
+    return ret;
 }
 
 char *__attribute__((weak)) pcTaskGetTaskName(TaskHandle_t xTaskToQuery) {
@@ -72,6 +248,120 @@ void Task_Simulated_HoldHandler(TaskHandle_t *handle_addr) {
     handler_to_save = handle_addr;
 }
 
+void Task_Simulated_RunUntil(TickType_t end_tick) {
+    if (running_task == NULL) {
+        while ((task_list != NULL) && !TICK_BEFORE(end_tick, task_list->wake_tick)) {
+            StaticTask_t *task = task_list;
+            task_list = task->next;
+            task->next = NULL;
+
+            if (TICK_BEFORE(so_tick_count, task->wake_tick)) {
+                so_tick_count = task->wake_tick;
+            }
+
+            if (task->coroutine == NULL) {
+                coroutine_t *coroutine = malloc(sizeof(coroutine_t));
+                if (coroutine == NULL) {
+                    printf("%s - line: %d\n", __FILE__, __LINE__);
+                    continue;
+                }
+                getcontext(&coroutine->context);
+                coroutine->context.uc_stack.ss_sp = coroutine->stack;
+                coroutine->context.uc_stack.ss_size = sizeof(coroutine->stack);
+                coroutine->context.uc_link = NULL;
+                makecontext(&coroutine->context, TaskEntry, 0);
+                task->coroutine = coroutine;
+            }
+
+            running_task = task;
+            swapcontext(&scheduler_context, &((coroutine_t *)task->coroutine)->context);
+            running_task = NULL;
+
+            ListInsert(task);
+        }
+        if (TICK_BEFORE(so_tick_count, end_tick)) {
+            so_tick_count = end_tick;
+        }
+    }
+}
+
+bool_t Task_Simulated_Running(void) {
+    return (running_task != NULL) ? TRUE : FALSE;
+}
+
+void Task_Simulated_Reset(void) {
+    while (task_list != NULL) {
+        StaticTask_t *task = task_list;
+        task_list = task->next;
+        task->next = NULL;
+        free(task->coroutine);
+        task->coroutine = NULL;
+    }
+    task_sequence = 0;
+}
+
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
+static void ListInsert(StaticTask_t *task) {
+    StaticTask_t **link = &task_list;
+    while (*link != NULL) {
+        StaticTask_t *other = *link;
+        if (TICK_BEFORE(task->wake_tick, other->wake_tick)) {
+            break;
+        }
+        if (task->wake_tick == other->wake_tick) {
+            if (task->priority > other->priority) {
+                break;
+            }
+            if ((task->priority == other->priority) && (task->sequence < other->sequence)) {
+                break;
+            }
+        }
+        link = &other->next;
+    }
+    task->next = *link;
+    *link = task;
+}
+
+static void ListRemove(StaticTask_t *task) {
+    StaticTask_t **link = &task_list;
+    while (*link != NULL) {
+        if (*link == task) {
+            *link = task->next;
+            task->next = NULL;
+            break;
+        }
+        link = &(*link)->next;
+    }
+}
+
+static void TaskEntry(void) {
+    StaticTask_t *task = running_task;
+    while (TRUE) {
+        task->delayed = FALSE;
+        task->TaskCallback(task->context);
+        if (!task->delayed) {
+            BlockRunningTask(so_tick_count + 1);
+        }
+    }
+}
+
+static void WakeNotified(StaticTask_t *task) {
+    if (task->notify_waiting && (task != running_task)) {
+        ListRemove(task);
+        task->wake_tick = so_tick_count;
+        ListInsert(task);
+    }
+}
+
+static void BlockRunningTask(TickType_t wake_tick) {
+    StaticTask_t *task = running_task;
+    if (scheduler_suspended > 0) {
+        printf("%s - line: %d\n", __FILE__, __LINE__);    /* FreeRTOS asserts, a task cannot block with the scheduler suspended */
+    }
+    task->wake_tick = wake_tick;
+    task->delayed = TRUE;
+    swapcontext(&((coroutine_t *)task->coroutine)->context, &scheduler_context);
+}
+
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
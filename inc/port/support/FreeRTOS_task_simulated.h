@@ -32,8 +32,27 @@ extern "C" {
 
 #define tskIDLE_PRIORITY          (( UBaseType_t ) 0U)  /**< Priority value for the idle task */
 
+#define taskENTER_CRITICAL()                ((void)0)               /**< Nothing interrupts the simulated tasks */
+#define taskEXIT_CRITICAL()                 ((void)0)
+
+#define taskENTER_CRITICAL_FROM_ISR()       (( UBaseType_t ) 0U)    /**< Nothing interrupts the simulated tasks */
+#define taskEXIT_CRITICAL_FROM_ISR(mask)    ((void)(mask))
+
+#define taskYIELD()                         ((void)0)               /**< A woken simulated task runs when the caller blocks */
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
+/**
+ * @brief Action of xTaskNotify on the notification value
+ */
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
 /**
  * @brief Function pointer type for task code
  */
@@ -42,10 +61,22 @@ typedef void (*TaskFunction_t)(void *);
 
 /**
  * @brief Structure representing a static task
+ *
+ * Besides the callback, it holds the entry of the task in the list of the
+ * virtual time scheduler (see Task_Simulated_RunUntil).
  */
-typedef struct {
+typedef struct StaticTask_s {
     TaskFunction_t TaskCallback;    /**< Pointer to the task function */
     void *context;                  /**< Context or parameters for the task */
+    UBaseType_t priority;           /**< Priority of the task */
+    TickType_t wake_tick;           /**< Tick at which the task runs again */
+    uint32_t sequence;              /**< Creation order, last tie breaker of the scheduler */
+    bool_t delayed;                 /**< The running iteration already blocked */
+    bool_t notify_waiting;          /**< Blocked in ulTaskNotifyTake or xTaskNotifyWait */
+    bool_t notify_pending;          /**< Notified since the last take or wait */
+    uint32_t notify_value;          /**< Notification count or bits */
+    void *coroutine;                /**< Host context and stack, allocated when it first runs */
+    struct StaticTask_s *next;      /**< Next task in the scheduler list */
 } StaticTask_t;
 
 typedef uint32_t StackType_t;       /**< Type definition for stack */
@@ -83,6 +114,13 @@ TaskHandle_t xTaskCreateStatic(TaskFunction_t pxTaskCode, const char *const pcNa
  */
 TickType_t xTaskGetTickCount(void);
 
+/**
+ * @brief Gets the current tick count from ISR.
+ *
+ * @return Current tick count.
+ */
+TickType_t xTaskGetTickCountFromISR(void);
+
 /**
  * @brief Holds the handler for a simulated task.
  *
@@ -90,9 +128,42 @@ TickType_t xTaskGetTickCount(void);
  */
 void Task_Simulated_HoldHandler(TaskHandle_t *handle_addr);
 
+/**
+ * @brief Run every created task in virtual time until a tick.
+ *
+ * Each task runs as a coroutine on a host stack, calling its body again every
+ * time it returns (task bodies under TEST run a single iteration per call).
+ * The scheduler resumes the task with the earliest wake tick, the highest
+ * priority on ties and the oldest one after that, moving so_tick_count to
+ * that tick, and the task runs until it blocks in vTaskDelay or
+ * vTaskDelayUntil. An iteration that never blocks yields until the next tick.
+ * Runs are deterministic and take only the CPU time of the task bodies. It
+ * must not be called from a task.
+ *
+ * @param end_tick Tick at which the run stops. so_tick_count ends there.
+ */
+void Task_Simulated_RunUntil(TickType_t end_tick);
+
+/**
+ * @brief Whether the caller runs as a task of Task_Simulated_RunUntil, and so can block.
+ *
+ * @return bool_t TRUE inside a task of the scheduler, FALSE otherwise.
+ */
+bool_t Task_Simulated_Running(void);
+
+/**
+ * @brief Remove every task from the virtual time scheduler.
+ *
+ * Tasks blocked in the middle of an iteration are dropped and start over
+ * when they are created again.
+ */
+void Task_Simulated_Reset(void);
+
 /**
  * @brief Delays the task for a specified number of ticks.
  *
+ * Without the scheduler running it just advances so_tick_count.
+ *
  * @param delay_ticks Number of ticks to delay the task.
  */
 void vTaskDelay(TickType_t delay_ticks);
@@ -100,11 +171,95 @@ void vTaskDelay(TickType_t delay_ticks);
 /**
  * @brief Delays the task until a specified time.
  *
+ * Without the scheduler running it just advances so_tick_count.
+ *
  * @param previous_time Pointer to the previous time.
  * @param delay_ticks Number of ticks to delay the task.
  */
 void vTaskDelayUntil(TickType_t *previous_time, TickType_t delay_ticks);
 
+/**
+ * @brief Suspend the scheduler.
+ *
+ * The virtual time scheduler only switches tasks when they block, which a
+ * task must not do while suspended, so only the nesting is kept.
+ */
+void vTaskSuspendAll(void);
+
+/**
+ * @brief Resume the scheduler.
+ *
+ * @return pdFALSE, a resume never switches tasks.
+ */
+BaseType_t xTaskResumeAll(void);
+
+/**
+ * @brief Increment the notification count of a task.
+ *
+ * A task blocked in ulTaskNotifyTake runs again at the current tick, after
+ * the caller blocks.
+ *
+ * @param xTaskToNotify Task handle to notify.
+ * @return pdPASS always.
+ */
+BaseType_t xTaskNotifyGive(TaskHandle_t xTaskToNotify);
+
+/**
+ * @brief Increment the notification count of a task from ISR.
+ *
+ * @param xTaskToNotify Task handle to notify.
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the task waited.
+ */
+void vTaskNotifyGiveFromISR(TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken);
+
+/**
+ * @brief Wait for the notification count of the running task.
+ *
+ * Without the scheduler running it returns at once.
+ *
+ * @param xClearCountOnExit pdTRUE clears the count, pdFALSE decrements it.
+ * @param xTicksToWait Maximum ticks to wait.
+ * @return Count before it was cleared or decremented, 0 on timeout.
+ */
+uint32_t ulTaskNotifyTake(BaseType_t xClearCountOnExit, TickType_t xTicksToWait);
+
+/**
+ * @brief Update the notification value of a task.
+ *
+ * A task blocked in ulTaskNotifyTake or xTaskNotifyWait runs again at the
+ * current tick, after the caller blocks.
+ *
+ * @param xTaskToNotify Task handle to notify.
+ * @param ulValue Value used by the action.
+ * @param eAction Update of the notification value.
+ * @return pdFAIL if eSetValueWithoutOverwrite found a notification pending, pdPASS otherwise.
+ */
+BaseType_t xTaskNotify(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction);
+
+/**
+ * @brief Update the notification value of a task from ISR.
+ *
+ * @param xTaskToNotify Task handle to notify.
+ * @param ulValue Value used by the action.
+ * @param eAction Update of the notification value.
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if the task waited.
+ * @return pdFAIL if eSetValueWithoutOverwrite found a notification pending, pdPASS otherwise.
+ */
+BaseType_t xTaskNotifyFromISR(TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken);
+
+/**
+ * @brief Wait for a notification of the running task.
+ *
+ * Without the scheduler running it returns at once.
+ *
+ * @param ulBitsToClearOnEntry Bits cleared before waiting, if no notification is pending.
+ * @param ulBitsToClearOnExit Bits cleared after the value is read.
+ * @param pulNotificationValue Where the value is stored before the exit clear. Can be NULL.
+ * @param xTicksToWait Maximum ticks to wait.
+ * @return pdTRUE if notified, pdFALSE on timeout.
+ */
+BaseType_t xTaskNotifyWait(uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait);
+
 /**
  * @brief Gets the name of a task.
  *
@@ -11,39 +11,139 @@
 /*========= [DEPENDENCIES] =====================================================*/
 
 #include "FreeRTOS_timers_simulated.h"
+#include "FreeRTOS_task_simulated.h"
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
+#define TICK_BEFORE(a, b)           ((int32_t)((a) - (b)) < 0)  /**< Wrap safe a < b */
+
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
 /*========= [TASK DECLARATIONS] ================================================*/
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
+/**
+ * @brief Insert a timer in the list ordered by expiry tick, after the ones that expire at the same tick.
+ */
+static void ListInsert(StaticTimer_t *timer);
+
+/**
+ * @brief Remove a timer from the list if it is there.
+ */
+static void ListRemove(StaticTimer_t *timer);
+
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
 
+static StaticTimer_t *timer_list = NULL; /**< Active timers, the next to expire first. */
+
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
 TimerHandle_t __attribute__((weak))  xTimerCreateStatic(const char *const pcTimerName, const TickType_t xTimerPeriodInTicks, const BaseType_t xAutoReload, void *const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer) {
-    return pxTimerBuffer;
+    TimerHandle_t handle = NULL;
+    if ((pxTimerBuffer != NULL) && (xTimerPeriodInTicks > 0)) {
+        pxTimerBuffer->name = pcTimerName;
+        pxTimerBuffer->period = xTimerPeriodInTicks;
+        pxTimerBuffer->auto_reload = xAutoReload;
+        pxTimerBuffer->id = pvTimerID;
+        pxTimerBuffer->callback = pxCallbackFunction;
+        pxTimerBuffer->active = FALSE;
+        pxTimerBuffer->next = NULL;
+        handle = pxTimerBuffer;
+    }
+    return handle;
 }
 
 BaseType_t __attribute__((weak)) xTimerReset(TimerHandle_t xTimer, TickType_t xTicksToWait) {
-    return pdTRUE;
+    return xTimerStart(xTimer, xTicksToWait);
 }
 
 BaseType_t __attribute__((weak)) xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait) {
+    ListRemove(xTimer);
+    xTimer->expiry_tick = so_tick_count + xTimer->period;
+    xTimer->active = TRUE;
+    ListInsert(xTimer);
     return pdTRUE;
 }
 
 BaseType_t __attribute__((weak)) xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait) {
+    ListRemove(xTimer);
+    xTimer->active = FALSE;
     return pdTRUE;
 }
 
+BaseType_t __attribute__((weak)) xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait) {
+    BaseType_t ret = pdFALSE;
+    if (xNewPeriod > 0) {
+        xTimer->period = xNewPeriod;
+        ret = xTimerStart(xTimer, xTicksToWait);
+    }
+    return ret;
+}
+
+void *__attribute__((weak)) pvTimerGetTimerID(TimerHandle_t xTimer) {
+    return xTimer->id;
+}
+
+void Timer_Simulated_RunUntil(TickType_t end_tick) {
+    while ((timer_list != NULL) && !TICK_BEFORE(end_tick, timer_list->expiry_tick)) {
+        StaticTimer_t *timer = timer_list;
+        timer_list = timer->next;
+        timer->next = NULL;
+
+        if (TICK_BEFORE(so_tick_count, timer->expiry_tick)) {
+            so_tick_count = timer->expiry_tick;
+        }
+        if (timer->auto_reload) {
+            // From the expiry, not from now, so a late service does not drift
+            timer->expiry_tick += timer->period;
+            ListInsert(timer);
+        }
+        else {
+            timer->active = FALSE;
+        }
+        if (timer->callback != NULL) {
+            timer->callback(timer);
+        }
+    }
+    if (TICK_BEFORE(so_tick_count, end_tick)) {
+        so_tick_count = end_tick;
+    }
+}
+
+void Timer_Simulated_Reset(void) {
+    while (timer_list != NULL) {
+        StaticTimer_t *timer = timer_list;
+        timer_list = timer->next;
+        timer->next = NULL;
+        timer->active = FALSE;
+    }
+}
+
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
+static void ListInsert(StaticTimer_t *timer) {
+    StaticTimer_t **link = &timer_list;
+    while ((*link != NULL) && !TICK_BEFORE(timer->expiry_tick, (*link)->expiry_tick)) {
+        link = &(*link)->next;
+    }
+    timer->next = *link;
+    *link = timer;
+}
+
+static void ListRemove(StaticTimer_t *timer) {
+    StaticTimer_t **link = &timer_list;
+    while ((*link != NULL) && (*link != timer)) {
+        link = &(*link)->next;
+    }
+    if (*link != NULL) {
+        *link = timer->next;
+        timer->next = NULL;
+    }
+}
+
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -24,7 +24,6 @@ extern "C" {
 #include "data_types.h"
 /// \endcond
 #include "FreeRTOS_simulated.h"
-#include "timer_manager.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
@@ -32,12 +31,27 @@ extern "C" {
 
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
-typedef timer_index_t StaticTimer_t;                            /**< Type definition for a static timer. */
-
-typedef StaticTimer_t *TimerHandle_t;                           /**< Type definition for timer handle. */
+typedef struct StaticTimer_s *TimerHandle_t;                    /**< Type definition for timer handle. */
 
 typedef void (*TimerCallbackFunction_t)(TimerHandle_t xTimer);  ///<Type definition for the timer callback function.
 
+/**
+ * @brief Structure representing a static timer
+ *
+ * Besides the configuration, it holds the entry of the timer in the list of
+ * the simulated timer service (see Timer_Simulated_RunUntil).
+ */
+typedef struct StaticTimer_s {
+    const char *name;                   /**< Name of the timer */
+    TickType_t period;                  /**< Period in ticks */
+    BaseType_t auto_reload;             /**< Start again when it expires */
+    void *id;                           /**< Timer ID */
+    TimerCallbackFunction_t callback;   /**< Function called when it expires */
+    TickType_t expiry_tick;             /**< Tick at which it expires */
+    bool_t active;                      /**< Running */
+    struct StaticTimer_s *next;         /**< Next timer to expire */
+} StaticTimer_t;
+
 /*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
 
 /**
@@ -80,6 +94,40 @@ BaseType_t xTimerStart(TimerHandle_t xTimer, TickType_t xTicksToWait);
  */
 BaseType_t xTimerStop(TimerHandle_t xTimer, TickType_t xTicksToWait);
 
+/**
+ * @brief Changes the period of a timer and starts it.
+ *
+ * @param xTimer Timer handle.
+ * @param xNewPeriod New period in ticks.
+ * @param xTicksToWait Ticks to wait for the operation.
+ * @return pdPASS if successful, pdFAIL otherwise.
+ */
+BaseType_t xTimerChangePeriod(TimerHandle_t xTimer, TickType_t xNewPeriod, TickType_t xTicksToWait);
+
+/**
+ * @brief Gets the ID of a timer.
+ *
+ * @param xTimer Timer handle.
+ * @return The ID given when the timer was created.
+ */
+void *pvTimerGetTimerID(TimerHandle_t xTimer);
+
+/**
+ * @brief Run the timer service until a tick.
+ *
+ * Calls the callbacks of the active timers in expiry order, moving
+ * so_tick_count to each expiry tick. It runs apart from
+ * Task_Simulated_RunUntil, so the callbacks must not block.
+ *
+ * @param end_tick Tick at which the run stops. so_tick_count ends there.
+ */
+void Timer_Simulated_RunUntil(TickType_t end_tick);
+
+/**
+ * @brief Stop every timer of the simulated timer service.
+ */
+void Timer_Simulated_Reset(void);
+
 #ifdef  __cplusplus
 }
 
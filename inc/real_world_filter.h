@@ -13,18 +13,68 @@
 
 /*========= [DEPENDENCIES] =====================================================*/
 
-#include <stdint.h>
+#include "biquad.h"
 
 /*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
 
+#define REAL_WORLD_FILTER_NUM_STAGES    1
+
 /*========= [PUBLIC DATA TYPE] =================================================*/
 
+/**
+ * @brief One simulated plant: its cascade, the state of the cascade and its coefficients.
+ *
+ * The filter points at the state of the same instance, so an instance is
+ * set up with REAL_WORLD_FILTER_PlantInit and not copied afterwards.
+ */
+typedef struct {
+    const int32_t *coefs;                                                       /**< Sections in Q2.30. */
+    int32_t state[REAL_WORLD_FILTER_NUM_STAGES * BIQUAD_STATE_PER_STAGE];       /**< State of the cascade in Q31. */
+    biquad_t filter;                                                            /**< Cascade run on the coefficients. */
+} real_world_plant_t;
+
 /*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
 
+/**
+ * @brief Load a plant with its coefficients and clear its state.
+ *
+ * @param plant     Plant instance.
+ * @param coefs     REAL_WORLD_FILTER_NUM_STAGES sections in Q2.30, NULL loads the built-in plant.
+ * @return bool_t   TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t REAL_WORLD_FILTER_PlantInit(real_world_plant_t *plant, const int32_t *coefs);
+
+/**
+ * @brief Clear the state of a plant.
+ *
+ * @param plant     Plant instance.
+ */
+void REAL_WORLD_FILTER_PlantReset(real_world_plant_t *plant);
+
+/**
+ * @brief Run one Q15 sample through a plant.
+ *
+ * @param plant     Plant instance.
+ * @param input     Input signal in Q15 format.
+ * @return int32_t  Output signal in Q15 format.
+ */
+int32_t REAL_WORLD_FILTER_PlantFilter(real_world_plant_t *plant, int32_t input);
+
+/**
+ * @brief Run a block of Q15 samples through a plant.
+ *
+ * @param plant     Plant instance.
+ * @param input     Input samples in Q15 format.
+ * @param output    Output samples in Q15 format, may be the input buffer.
+ * @param size      Number of samples.
+ */
+void REAL_WORLD_FILTER_PlantFilterBlock(real_world_plant_t *plant, const int32_t *input, int32_t *output, size_t size);
+
 /**
  * @brief Resets the filter state.
  *
- * This function resets the internal state of the filter buffers.
+ * This function resets the internal state of the filter buffers. This and
+ * the functions below run the default plant of the module.
  */
 int32_t REAL_WORLD_FILTER_Reset(void);
 
@@ -32,12 +82,24 @@ int32_t REAL_WORLD_FILTER_Reset(void);
  * @brief Filters input signal using a digital filter.
  *
  * This function implements a digital filter to process the input signal. It takes
- * the input signal in Q15 format and applies a numerator-denominator filter with
- * coefficients provided as Q15 fixed-point values.
+ * the input signal in Q15 format and runs it through a cascade of second order
+ * sections with Q2.30 coefficients and Q31 state.
  *
  * @param input Input signal in Q15 format.
  * @return Filtered output signal in Q15 format.
  */
 int32_t REAL_WORLD_FILTER_Filter(int32_t input);
 
+/**
+ * @brief Filters a block of samples using the same filter as REAL_WORLD_FILTER_Filter.
+ *
+ * Gives the same result as calling REAL_WORLD_FILTER_Filter for every sample, without the
+ * per-sample call overhead. Input and output may be the same buffer.
+ *
+ * @param input  Input samples in Q15 format.
+ * @param output Filtered output samples in Q15 format.
+ * @param size   Number of samples.
+ */
+void REAL_WORLD_FILTER_FilterBlock(const int32_t *input, int32_t *output, size_t size);
+
 #endif  /* REAL_WORLD_FILTER_H */
@@ -0,0 +1,79 @@
+/**
+ * @file rls.h
+ * @author Marcos Dominguez
+ *
+ * @brief Recursive least squares estimator with forgetting factor.
+ *
+ * Estimates theta in y = phi' theta one sample at a time. Memory is the
+ * parameter vector and the covariance matrix, O(n^2), independent of the
+ * number of samples. Single precision so every operation runs on the M4F FPU.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef RLS_H
+#define RLS_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define RLS_MAX_PARAMS  8   /**< Largest parameter vector of an instance. */
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Estimator instance.
+ */
+typedef struct {
+    float theta[RLS_MAX_PARAMS];                    /**< Estimated parameters. */
+    float P[RLS_MAX_PARAMS][RLS_MAX_PARAMS];        /**< Covariance of the estimation, symmetric. */
+    float lambda;                                   /**< Forgetting factor, 1 keeps every sample. */
+    uint8_t num_params;                             /**< Parameters in use. */
+} rls_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the estimator and start from theta = 0 and P = p0 I.
+ *
+ * @param rls           Estimator instance.
+ * @param num_params    Number of parameters, up to RLS_MAX_PARAMS.
+ * @param lambda        Forgetting factor in (0, 1]. Memory is about 1 / (1 - lambda) samples.
+ * @param p0            Initial covariance, large when nothing is known of theta.
+ * @return bool_t       TRUE: Operation success - FALSE: Operation fail.
+ */
+bool_t RLS_Init(rls_t *rls, uint8_t num_params, float lambda, float p0);
+
+/**
+ * @brief Restart the estimation from theta = 0 and P = p0 I.
+ *
+ * @param rls           Estimator instance.
+ * @param p0            Initial covariance.
+ */
+void RLS_Reset(rls_t *rls, float p0);
+
+/**
+ * @brief Update the estimation with one sample.
+ *
+ * @param rls           Estimator instance.
+ * @param phi           Regressor, num_params elements.
+ * @param y             Measured output.
+ * @return float        A priori prediction error y - phi' theta.
+ */
+float RLS_Update(rls_t *rls, const float *phi, float y);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* RLS_H */
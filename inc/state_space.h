@@ -0,0 +1,157 @@
+/**
+ * @file state_space.h
+ * @author Marcos Dominguez
+ *
+ * @brief Arithmetic shared by the state space controllers and observers.
+ *
+ * STATE_SPACE_ARITHMETIC selects the representation at build time. The
+ * Cortex-M4F FPU is single precision only, so STATE_SPACE_FLOAT is the
+ * default: every operation maps to one FPU instruction instead of a
+ * soft-float call. STATE_SPACE_Q31 keeps every value in a signed 32 bit word
+ * with STATE_SPACE_FRAC_BITS fractional bits and accumulates the products in
+ * 64 bits, and STATE_SPACE_DOUBLE is the reference.
+ *
+ * The kernels themselves are generated for each set of dimensions by
+ * including state_space_template.h.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef STATE_SPACE_H
+#define STATE_SPACE_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define STATE_SPACE_DOUBLE  1
+#define STATE_SPACE_FLOAT   2
+#define STATE_SPACE_Q31     3
+
+#ifndef STATE_SPACE_ARITHMETIC
+#define STATE_SPACE_ARITHMETIC STATE_SPACE_FLOAT
+#endif
+
+/**
+ * @brief Fractional bits of the fixed point representation.
+ *
+ * Q8.23 covers +-256 with a resolution of 1.2e-7. The estimated states of the
+ * identified model reach about 11 times the control action, so volts in the
+ * 0 - 3.3 range stay well inside.
+ */
+#define STATE_SPACE_FRAC_BITS   23
+
+#if (STATE_SPACE_ARITHMETIC == STATE_SPACE_DOUBLE)
+#define STATE_SPACE_REAL(x)     ((double)(x))
+#elif (STATE_SPACE_ARITHMETIC == STATE_SPACE_FLOAT)
+#define STATE_SPACE_REAL(x)     ((float)(x))
+#elif (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+/**
+ * @brief Convert a constant to the fixed point representation, rounding to nearest.
+ */
+#define STATE_SPACE_REAL(x)     ((int32_t)(((x) >= 0) ? ((x) * (double)(1L << STATE_SPACE_FRAC_BITS) + 0.5) \
+                                                      : ((x) * (double)(1L << STATE_SPACE_FRAC_BITS) - 0.5)))
+#else
+#error "Invalid STATE_SPACE_ARITHMETIC"
+#endif
+
+/**
+ * @brief Ask the compiler to unroll the next loop. The bounds of every loop
+ * in the kernels are compile-time constants, so they unroll completely.
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#define STATE_SPACE_UNROLL      _Pragma("GCC unroll 16")
+#elif defined(__clang__)
+#define STATE_SPACE_UNROLL      _Pragma("unroll")
+#else
+#define STATE_SPACE_UNROLL
+#endif
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+#if (STATE_SPACE_ARITHMETIC == STATE_SPACE_DOUBLE)
+typedef double state_space_real_t;
+typedef double state_space_acc_t;
+#elif (STATE_SPACE_ARITHMETIC == STATE_SPACE_FLOAT)
+typedef float state_space_real_t;
+typedef float state_space_acc_t;
+#else
+typedef int32_t state_space_real_t;
+typedef int64_t state_space_acc_t;     /**< Products keep 2 * STATE_SPACE_FRAC_BITS fractional bits. */
+#endif
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Multiply two values into an accumulator.
+ */
+static inline state_space_acc_t STATE_SPACE_Product(state_space_real_t x, state_space_real_t y) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return (int64_t)x * (int64_t)y;
+    #else
+    return x * y;
+    #endif
+}
+
+/**
+ * @brief Bring a value to the scale of the accumulator.
+ */
+static inline state_space_acc_t STATE_SPACE_ToAcc(state_space_real_t x) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return (int64_t)x * (1LL << STATE_SPACE_FRAC_BITS);
+    #else
+    return x;
+    #endif
+}
+
+/**
+ * @brief Bring an accumulator back to the representation.
+ *
+ * The fixed point path rounds to nearest and saturates, so every output of
+ * a kernel is rounded a single time.
+ */
+static inline state_space_real_t STATE_SPACE_FromAcc(state_space_acc_t acc) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    acc = (acc + (1LL << (STATE_SPACE_FRAC_BITS - 1))) >> STATE_SPACE_FRAC_BITS;
+    if (acc > INT32_MAX) {
+        acc = INT32_MAX;
+    }
+    else if (acc < INT32_MIN) {
+        acc = INT32_MIN;
+    }
+    return (int32_t)acc;
+    #else
+    return acc;
+    #endif
+}
+
+/**
+ * @brief Convert a reading in mV to volts in the selected representation.
+ *
+ * @param mv                    Value in mV.
+ * @return state_space_real_t   Value in V.
+ */
+state_space_real_t STATE_SPACE_FromMv(int32_t mv);
+
+/**
+ * @brief Convert volts in the selected representation to mV, truncating.
+ *
+ * @param value     Value in V.
+ * @return int32_t  Value in mV.
+ */
+int32_t STATE_SPACE_ToMv(state_space_real_t value);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* STATE_SPACE_H */
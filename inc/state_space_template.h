@@ -0,0 +1,261 @@
+/**
+ * @file state_space_template.h
+ * @author Marcos Dominguez
+ *
+ * @brief State space controller and observer kernels for fixed dimensions.
+ *
+ * Define the name and the dimensions and include this file once for each
+ * plant:
+ *
+ *     #define STATE_SPACE_NAME     plant          // types plant_model_t, plant_gain_t, plant_t
+ *     #define STATE_SPACE_PREFIX   PLANT          // functions PLANT_Init, PLANT_Update, ...
+ *     #define STATE_SPACE_STATES   2
+ *     #define STATE_SPACE_INPUTS   1
+ *     #define STATE_SPACE_OUTPUTS  1
+ *     #include "state_space_template.h"
+ *
+ * The model is x[k+1] = A x[k] + B u[k], y[k] = C x[k] with a Luenberger
+ * observer of gain L. Every loop has constant bounds and is unrolled, the
+ * state is updated in place and no static buffers are used, so several
+ * instances run from different tasks. The parameters are undefined at the end
+ * so the file can be included again.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "state_space.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#if !defined(STATE_SPACE_NAME) || !defined(STATE_SPACE_PREFIX)
+#error "Define STATE_SPACE_NAME and STATE_SPACE_PREFIX before including state_space_template.h"
+#endif
+
+#if !defined(STATE_SPACE_STATES) || !defined(STATE_SPACE_INPUTS) || !defined(STATE_SPACE_OUTPUTS)
+#error "Define STATE_SPACE_STATES, STATE_SPACE_INPUTS and STATE_SPACE_OUTPUTS before including state_space_template.h"
+#endif
+
+#define SS_CONCAT_(a, b)    a##b
+#define SS_CONCAT(a, b)     SS_CONCAT_(a, b)
+#define SS_TYPE(suffix)     SS_CONCAT(STATE_SPACE_NAME, suffix)
+#define SS_FUNC(suffix)     SS_CONCAT(STATE_SPACE_PREFIX, suffix)
+
+#define SS_N                STATE_SPACE_STATES
+#define SS_M                STATE_SPACE_INPUTS
+#define SS_P                STATE_SPACE_OUTPUTS
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief Model of the plant and gain of the observer.
+ */
+typedef struct {
+    state_space_real_t A[SS_N][SS_N];   /**< State matrix. */
+    state_space_real_t B[SS_N][SS_M];   /**< Input matrix. */
+    state_space_real_t C[SS_P][SS_N];   /**< Output matrix. */
+    state_space_real_t L[SS_N][SS_P];   /**< Observer gain. */
+} SS_TYPE(_model_t);
+
+/**
+ * @brief Gains of the state feedback law u = Ko r - K x.
+ */
+typedef struct {
+    state_space_real_t K[SS_M][SS_N];   /**< State feedback gain. */
+    state_space_real_t Ko[SS_M][SS_P];  /**< Reference gain. */
+} SS_TYPE(_gain_t);
+
+/**
+ * @brief Observer instance.
+ */
+typedef struct {
+    const SS_TYPE(_model_t) *model;     /**< Model used by the prediction. */
+    state_space_real_t x[SS_N];         /**< Estimated state. */
+} SS_TYPE(_t);
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Load the observer struct and clear the estimated state.
+ *
+ * @param observer  Observer instance.
+ * @param model     Model and observer gain.
+ * @return bool_t   TRUE: Operation success - FALSE: Operation fail.
+ */
+static inline bool_t SS_FUNC(_Init)(SS_TYPE(_t) *observer, const SS_TYPE(_model_t) *model) {
+    bool_t ret = FALSE;
+    if (observer != NULL) {
+        if (model != NULL) {
+            observer->model = model;
+            STATE_SPACE_UNROLL
+            for (uint8_t i = 0; i < SS_N; i++) {
+                observer->x[i] = STATE_SPACE_REAL(0);
+            }
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * @brief Compute the state feedback u = Ko r - K x.
+ *
+ * @param gain      Controller gains.
+ * @param x         Measured or estimated state.
+ * @param r         Reference, one for each output.
+ * @param u         Control action, one for each input.
+ */
+static inline void SS_FUNC(_Control)(const SS_TYPE(_gain_t) *gain, const state_space_real_t x[SS_N], const state_space_real_t r[SS_P], state_space_real_t u[SS_M]) {
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_M; i++) {
+        state_space_acc_t acc = 0;
+        STATE_SPACE_UNROLL
+        for (uint8_t k = 0; k < SS_P; k++) {
+            acc += STATE_SPACE_Product(gain->Ko[i][k], r[k]);
+        }
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc -= STATE_SPACE_Product(gain->K[i][j], x[j]);
+        }
+        u[i] = STATE_SPACE_FromAcc(acc);
+    }
+}
+
+/**
+ * @brief Compute the output expected from the estimated state, y = C x.
+ *
+ * @param observer  Observer instance.
+ * @param y         Estimated output, one for each output.
+ */
+static inline void SS_FUNC(_Output)(const SS_TYPE(_t) *observer, state_space_real_t y[SS_P]) {
+    const SS_TYPE(_model_t) *model = observer->model;
+    STATE_SPACE_UNROLL
+    for (uint8_t k = 0; k < SS_P; k++) {
+        state_space_acc_t acc = 0;
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc += STATE_SPACE_Product(model->C[k][j], observer->x[j]);
+        }
+        y[k] = STATE_SPACE_FromAcc(acc);
+    }
+}
+
+/**
+ * @brief Predict the next state from the model, x = A x + B u.
+ *
+ * @param observer  Observer instance.
+ * @param u         Control action applied during the sample.
+ */
+static inline void SS_FUNC(_Predict)(SS_TYPE(_t) *observer, const state_space_real_t u[SS_M]) {
+    const SS_TYPE(_model_t) *model = observer->model;
+    state_space_real_t next[SS_N];  /* Lives in registers once unrolled */
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_N; i++) {
+        state_space_acc_t acc = 0;
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc += STATE_SPACE_Product(model->A[i][j], observer->x[j]);
+        }
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_M; j++) {
+            acc += STATE_SPACE_Product(model->B[i][j], u[j]);
+        }
+        next[i] = STATE_SPACE_FromAcc(acc);
+    }
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_N; i++) {
+        observer->x[i] = next[i];
+    }
+}
+
+/**
+ * @brief Correct the estimated state with a measurement, x = x + L (y - C x).
+ *
+ * @param observer  Observer instance.
+ * @param y         Measured output, one for each output.
+ */
+static inline void SS_FUNC(_Correct)(SS_TYPE(_t) *observer, const state_space_real_t y[SS_P]) {
+    const SS_TYPE(_model_t) *model = observer->model;
+    state_space_real_t innovation[SS_P];
+    STATE_SPACE_UNROLL
+    for (uint8_t k = 0; k < SS_P; k++) {
+        state_space_acc_t acc = STATE_SPACE_ToAcc(y[k]);
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc -= STATE_SPACE_Product(model->C[k][j], observer->x[j]);
+        }
+        innovation[k] = STATE_SPACE_FromAcc(acc);
+    }
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_N; i++) {
+        state_space_acc_t acc = STATE_SPACE_ToAcc(observer->x[i]);
+        STATE_SPACE_UNROLL
+        for (uint8_t k = 0; k < SS_P; k++) {
+            acc += STATE_SPACE_Product(model->L[i][k], innovation[k]);
+        }
+        observer->x[i] = STATE_SPACE_FromAcc(acc);
+    }
+}
+
+/**
+ * @brief Advance the predictor form observer one sample,
+ * x = A x + B u + L (y - C x), with the innovation taken before the prediction.
+ *
+ * Each new state is accumulated in one pass, so the fixed point path rounds
+ * it a single time.
+ *
+ * @param observer  Observer instance.
+ * @param u         Control action applied during the sample.
+ * @param y         Measured output, one for each output.
+ */
+static inline void SS_FUNC(_Update)(SS_TYPE(_t) *observer, const state_space_real_t u[SS_M], const state_space_real_t y[SS_P]) {
+    const SS_TYPE(_model_t) *model = observer->model;
+    state_space_real_t innovation[SS_P];
+    state_space_real_t next[SS_N];
+    STATE_SPACE_UNROLL
+    for (uint8_t k = 0; k < SS_P; k++) {
+        state_space_acc_t acc = STATE_SPACE_ToAcc(y[k]);
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc -= STATE_SPACE_Product(model->C[k][j], observer->x[j]);
+        }
+        innovation[k] = STATE_SPACE_FromAcc(acc);
+    }
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_N; i++) {
+        state_space_acc_t acc = 0;
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_N; j++) {
+            acc += STATE_SPACE_Product(model->A[i][j], observer->x[j]);
+        }
+        STATE_SPACE_UNROLL
+        for (uint8_t j = 0; j < SS_M; j++) {
+            acc += STATE_SPACE_Product(model->B[i][j], u[j]);
+        }
+        STATE_SPACE_UNROLL
+        for (uint8_t k = 0; k < SS_P; k++) {
+            acc += STATE_SPACE_Product(model->L[i][k], innovation[k]);
+        }
+        next[i] = STATE_SPACE_FromAcc(acc);
+    }
+    STATE_SPACE_UNROLL
+    for (uint8_t i = 0; i < SS_N; i++) {
+        observer->x[i] = next[i];
+    }
+}
+
+#undef SS_N
+#undef SS_M
+#undef SS_P
+#undef SS_TYPE
+#undef SS_FUNC
+#undef SS_CONCAT
+#undef SS_CONCAT_
+#undef STATE_SPACE_NAME
+#undef STATE_SPACE_PREFIX
+#undef STATE_SPACE_STATES
+#undef STATE_SPACE_INPUTS
+#undef STATE_SPACE_OUTPUTS
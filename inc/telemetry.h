@@ -0,0 +1,91 @@
+/**
+ * @file telemetry.h
+ * @author Marcos Dominguez
+ *
+ * @brief Telemetry of the control loop.
+ *
+ * The control task pushes a fixed size record into a single producer single
+ * consumer ring (osal_spsc.h) in O(1) and a low priority task, woken when
+ * records arrive, drains it to the UART as CSV. When the ring is full the
+ * record is dropped and counted, so logging never delays the actuation.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "data_types.h"
+#include "utils.h"
+
+/*========= [PUBLIC MACRO AND CONSTANTS] =======================================*/
+
+#define TELEMETRY_RING_SIZE         64  /**< Records in the ring, power of 2. 320 ms of backlog at 5 ms. */
+
+/*========= [PUBLIC DATA TYPE] =================================================*/
+
+/**
+ * @brief One sample of the control loop.
+ */
+typedef struct {
+    uint32_t tick;          /**< Tick of the sample. */
+    int32_t reference;      /**< Reference in mV. */
+    int32_t u;              /**< Control action in mV. */
+    int32_t y;              /**< Output in mV. */
+} telemetry_record_t;
+
+/*========= [PUBLIC FUNCTION DECLARATIONS] =====================================*/
+
+/**
+ * @brief Create the drain task.
+ */
+void TELEMETRY_Init(void);
+
+/**
+ * @brief Push a record. It never blocks, a full ring drops the record.
+ *
+ * Only one task may push.
+ *
+ * @param tick          Tick of the sample.
+ * @param reference     Reference in mV.
+ * @param u             Control action in mV.
+ * @param y             Output in mV.
+ * @return bool_t       TRUE: Record queued - FALSE: Ring full, record dropped.
+ */
+bool_t TELEMETRY_Push(uint32_t tick, int32_t reference, int32_t u, int32_t y);
+
+/**
+ * @brief Pop the oldest record. Only one task may pop.
+ *
+ * @param record        Where the record is copied.
+ * @return bool_t       TRUE: Record copied - FALSE: Ring empty.
+ */
+bool_t TELEMETRY_Pop(telemetry_record_t *record);
+
+/**
+ * @brief Number of records dropped because the ring was full.
+ *
+ * @return uint32_t     Dropped records since start up.
+ */
+uint32_t TELEMETRY_GetDropped(void);
+
+/**
+ * @brief Highest number of records waiting in the ring.
+ *
+ * @return uint32_t     High water mark since start up.
+ */
+uint32_t TELEMETRY_GetHighWater(void);
+
+#ifdef  __cplusplus
+}
+
+#endif
+
+#endif  /* TELEMETRY_H */
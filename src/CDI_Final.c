@@ -17,6 +17,7 @@
 
 #include "control.h"
 #include "identificacion.h"
+#include "bode.h"
 
 /*=====[Definition macros of private constants]==============================*/
 
@@ -24,6 +25,8 @@
 
 #define CONTROLAR 1 
 
+#define BARRER_FRECUENCIA 2 
+
 #define TAREA CONTROLAR
 
 /*=====[Definitions of extern global variables]==============================*/
@@ -42,7 +45,9 @@ int main( void )
    #if(TAREA==CONTROLAR)
    CONTROLLER_Init();
    #elif(TAREA==IDENTIFICAR)
-   IDENTIFICACION_Init();
+   IDENTIFICACION_Init();   // With IDENTIFICACION_CLOSED_LOOP it also starts the controller
+   #elif(TAREA==BARRER_FRECUENCIA)
+   BODE_Init();
    #endif
    vTaskStartScheduler(); // Initialize scheduler
 
@@ -0,0 +1,128 @@
+/**
+ * @file arx.c
+ * @author Marcos Dominguez
+ *
+ * @brief Regressor of ARX and ARMAX models of configurable order.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "arx.h"
+#include <string.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MUL_ELEMENTS(a, b) ((a)*(b))
+
+#define MAX(a, b)   (((a) > (b)) ? (a) : (b))
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Shift a segment of the regressor one place and put a value first.
+ */
+static void ShiftIn(float *segment, uint8_t size, float value);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t ARX_Init(arx_t *arx, uint8_t na, uint8_t nb, uint8_t nk, uint8_t nc) {
+    bool_t ret = FALSE;
+    if (arx != NULL) {
+        if ((nb > 0) && (nk <= ARX_MAX_DELAY) && ((na + nb + nc) <= ARX_MAX_PARAMS)) {
+            arx->na = na;
+            arx->nb = nb;
+            arx->nk = nk;
+            arx->nc = nc;
+            ARX_Reset(arx);
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+void ARX_Reset(arx_t *arx) {
+    memset(arx->phi, 0, sizeof(arx->phi));
+    memset(arx->u_delay, 0, sizeof(arx->u_delay));
+    arx->samples = 0;
+}
+
+uint8_t ARX_NumParams(const arx_t *arx) {
+    return arx->na + arx->nb + arx->nc;
+}
+
+const float *ARX_Regressor(arx_t *arx, float u) {
+    float u_delayed = u;
+    if (arx->nk > 0) {
+        u_delayed = arx->u_delay[arx->nk - 1];
+        ShiftIn(arx->u_delay, arx->nk, u);
+    }
+    ShiftIn(&arx->phi[arx->na], arx->nb, u_delayed);
+
+    return arx->phi;
+}
+
+bool_t ARX_Ready(const arx_t *arx) {
+    uint16_t needed = MAX(MAX(arx->na, arx->nc), arx->nk + arx->nb - 1);
+    return (arx->samples >= needed) ? TRUE : FALSE;
+}
+
+float ARX_Residual(const arx_t *arx, const float *theta, float y) {
+    float residual = y;
+    uint8_t n = ARX_NumParams(arx);
+    for (uint8_t i = 0; i < n; i++) {
+        residual -= MUL_ELEMENTS(arx->phi[i], theta[i]);
+    }
+
+    return residual;
+}
+
+void ARX_Advance(arx_t *arx, float y, float e) {
+    ShiftIn(&arx->phi[0], arx->na, -y);
+    ShiftIn(&arx->phi[arx->na + arx->nb], arx->nc, e);
+    if (arx->samples < UINT16_MAX) {
+        arx->samples++;
+    }
+}
+
+void ARX_GetPolynomials(const arx_t *arx, const float *theta, float *den, float *num, float *noise) {
+    den[0] = 1.0f;
+    for (uint8_t i = 0; i < arx->na; i++) {
+        den[i + 1] = theta[i];
+    }
+    for (uint8_t i = 0; i < arx->nb; i++) {
+        num[i] = theta[arx->na + i];
+    }
+    if (noise != NULL) {
+        noise[0] = 1.0f;
+        for (uint8_t i = 0; i < arx->nc; i++) {
+            noise[i + 1] = theta[arx->na + arx->nb + i];
+        }
+    }
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static void ShiftIn(float *segment, uint8_t size, float value) {
+    if (size > 0) {
+        for (uint8_t i = size - 1; i > 0; i--) {
+            segment[i] = segment[i - 1];
+        }
+        segment[0] = value;
+    }
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,164 @@
+/**
+ * @file autotune.c
+ * @author Marcos Dominguez
+ *
+ * @brief Controller synthesis from an identified second order model.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "autotune.h"
+#include "discretize.h"
+#include "linalg.h"
+#include <math.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define DIOPHANTINE_SIZE    4       /**< r1, s0, s1, s2 */
+
+#define MIN_DETERMINANT     1e-9    /**< Below it the model is taken as not observable. */
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static pid_tuning_t pid_tunings[2];                         /**< Active and next PID design */
+
+static controller_observer_tuning_t observer_tunings[2];    /**< Active and next observed design */
+
+static uint8_t next_pid = 0;                                /**< Buffer of the next PID design */
+
+static uint8_t next_observer = 0;                           /**< Buffer of the next observed design */
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t AUTOTUNE_PidSynthesize(const float *den, const float *num, const autotune_poles_t *poles, pid_tuning_t *tuning) {
+    bool_t ret = FALSE;
+    if ((den != NULL) && (num != NULL) && (poles != NULL) && (tuning != NULL)) {
+        float a1 = den[1];
+        float a2 = den[2];
+        float b1 = num[1];
+        float b2 = num[2];
+
+        // P = 1 + p1 z^-1 + p2 z^-2 + p3 z^-3 + p4 z^-4 from its four roots
+        float p[DIOPHANTINE_SIZE + 1] = {1.0f};
+        for (uint8_t i = 0; i < DIOPHANTINE_SIZE; i++) {
+            for (uint8_t j = i + 1; j > 0; j--) {
+                p[j] -= poles->pid[i] * p[j - 1];
+            }
+        }
+
+        // A R + B S = P with R = (1 - z^-1)(1 + r1 z^-1), matching z^-1 .. z^-4
+        float M[DIOPHANTINE_SIZE * DIOPHANTINE_SIZE] = {
+            1.0f,       b1,     0.0f,   0.0f,
+            a1 - 1.0f,  b2,     b1,     0.0f,
+            a2 - a1,    0.0f,   b2,     b1,
+            -a2,        0.0f,   0.0f,   b2,
+        };
+        float rhs[DIOPHANTINE_SIZE] = {p[1] + 1.0f - a1, p[2] + a1 - a2, p[3] + a2, p[4]};
+        float x[DIOPHANTINE_SIZE];
+
+        if (LINALG_QrLeastSquares(M, DIOPHANTINE_SIZE, DIOPHANTINE_SIZE, rhs, x)) {
+            float r1 = x[0];
+            float gain = fmaxf(fabsf(x[1]), fmaxf(fabsf(x[2]), fabsf(x[3])));
+            uint8_t shift = 0;
+            while ((gain >= 1.0f) && (shift < AUTOTUNE_MAX_SHIFT)) {    // Numerator below 1, the Q2.30 range keeps a bit of margin
+                gain *= 0.5f;
+                shift++;
+            }
+            if ((fabsf(r1) < 1.0f) && (gain < 1.0f)) {
+                float scale = 1.0f / (float)(1UL << shift);
+                tuning->coefs[0] = BIQUAD_COEF(x[1] * scale);
+                tuning->coefs[1] = BIQUAD_COEF(x[2] * scale);
+                tuning->coefs[2] = BIQUAD_COEF(x[3] * scale);
+                tuning->coefs[3] = BIQUAD_COEF(r1 - 1.0f);
+                tuning->coefs[4] = BIQUAD_COEF(-r1);
+                tuning->gain_shift = shift;
+                tuning->reference_weight = 1;   // The integrator removes the error
+                ret = TRUE;
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool_t AUTOTUNE_ObserverSynthesize(const float *den, const float *num, const autotune_poles_t *poles, controller_observer_tuning_t *tuning) {
+    bool_t ret = FALSE;
+    if ((den != NULL) && (num != NULL) && (poles != NULL) && (tuning != NULL)) {
+        double a11 = -den[1];
+        double a12 = -den[2];
+        double a21 = 1.0;
+        double a22 = 0.0;
+        double b1 = 1.0;
+        double b2 = 0.0;
+        double cc1 = num[1];
+        double cc2 = num[2];
+        double c1 = DISCRETIZE_POLY_C1(poles->control[0], poles->control[1]);
+        double c2 = DISCRETIZE_POLY_C2(poles->control[0], poles->control[1]);
+        double o1 = DISCRETIZE_POLY_C1(poles->observer[0], poles->observer[1]);
+        double o2 = DISCRETIZE_POLY_C2(poles->observer[0], poles->observer[1]);
+
+        if (fabs(DISCRETIZE_OBSV_DET(a11, a12, a21, a22, cc1, cc2)) > MIN_DETERMINANT) {
+            double k1 = DISCRETIZE_ACKERMANN_K1(a11, a12, a21, a22, b1, b2, c1, c2);
+            double k2 = DISCRETIZE_ACKERMANN_K2(a11, a12, a21, a22, b1, b2, c1, c2);
+            double ko = DISCRETIZE_REFERENCE_GAIN(a11, a12, a21, a22, b1, b2, cc1, cc2, k1, k2);
+
+            if (isfinite(ko)) {
+                pole_placement_model_t *model = &tuning->model;
+                model->A[0][0] = STATE_SPACE_REAL(a11);
+                model->A[0][1] = STATE_SPACE_REAL(a12);
+                model->A[1][0] = STATE_SPACE_REAL(a21);
+                model->A[1][1] = STATE_SPACE_REAL(a22);
+                model->B[0][0] = STATE_SPACE_REAL(b1);
+                model->B[1][0] = STATE_SPACE_REAL(b2);
+                model->C[0][0] = STATE_SPACE_REAL(cc1);
+                model->C[0][1] = STATE_SPACE_REAL(cc2);
+                model->L[0][0] = STATE_SPACE_REAL(DISCRETIZE_OBSERVER_L1(a11, a12, a21, a22, cc1, cc2, o1, o2));
+                model->L[1][0] = STATE_SPACE_REAL(DISCRETIZE_OBSERVER_L2(a11, a12, a21, a22, cc1, cc2, o1, o2));
+                tuning->gain.K[0][0] = STATE_SPACE_REAL(k1);
+                tuning->gain.K[0][1] = STATE_SPACE_REAL(k2);
+                tuning->gain.Ko[0][0] = STATE_SPACE_REAL(ko);
+                ret = TRUE;
+            }
+        }
+    }
+
+    return ret;
+}
+
+bool_t AUTOTUNE_Apply(const float *den, const float *num, const autotune_poles_t *poles) {
+    bool_t ret = TRUE;
+
+    if (AUTOTUNE_PidSynthesize(den, num, poles, &pid_tunings[next_pid])) {
+        PID_SetTuning(&pid_tunings[next_pid]);
+        next_pid ^= 1;      // Only once published, the buffer in use is never the next one
+    }
+    else {
+        ret = FALSE;
+    }
+    if (AUTOTUNE_ObserverSynthesize(den, num, poles, &observer_tunings[next_observer])) {
+        CONTROLLER_SetObserverTuning(&observer_tunings[next_observer]);
+        next_observer ^= 1;
+    }
+    else {
+        ret = FALSE;
+    }
+
+    return ret;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,251 @@
+/**
+ * @file biquad.c
+ * @author Marcos Dominguez
+ *
+ * @brief Cascade of second order sections in transposed direct form II.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "biquad.h"
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_1__)
+#include <smmintrin.h>
+#endif
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MUL_ELEMENTS_64(x, y)   ((int64_t)(x) * (int64_t)(y))
+
+#define STATE_TO_ACC(x)         ((int64_t)(x) * (1LL << BIQUAD_COEF_SHIFT))
+
+#define ACC_ROUND               (1LL << (BIQUAD_COEF_SHIFT - 1))
+
+#define Q15_TO_Q31_SHIFT        (16 - BIQUAD_HEADROOM_BITS)
+
+#if defined(__AVX2__) || defined(__SSE4_1__)
+#define BLOCK_USE_SIMD          1
+#define BLOCK_CHUNK             32  /**< Samples whose feed-forward products are computed at once. */
+#else
+#define BLOCK_USE_SIMD          0
+#endif
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Bring a 64 bit value to 32 bits saturating at the limits.
+ */
+__STATIC_FORCEINLINE int32_t Saturate32(int64_t value);
+
+/**
+ * @brief Scale a Q2.30 x Q31 accumulator back to Q31 with rounding and saturation.
+ */
+__STATIC_FORCEINLINE int32_t AccToQ31(int64_t acc);
+
+/**
+ * @brief Run one section over one sample given its feed-forward products.
+ *
+ * Every path of the module goes through here so they stay bit-exact.
+ */
+__STATIC_FORCEINLINE int32_t StageUpdate(int64_t p0, int64_t p1, int64_t p2, int32_t a1, int32_t a2, int32_t *s1, int32_t *s2);
+
+/**
+ * @brief Run one section over a block of samples.
+ */
+static void StageBlock(const int32_t *coef, int32_t *state, const int32_t *input, int32_t *output, size_t size);
+
+#if BLOCK_USE_SIMD
+/**
+ * @brief Compute b0 x, b1 x and b2 x for a chunk of samples with SIMD.
+ */
+static void FeedForwardChunk(const int32_t *coef, const int32_t *input, size_t size, int64_t *p0, int64_t *p1, int64_t *p2);
+#endif
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t BIQUAD_Init(biquad_t *filter, const int32_t *coefs, int32_t *state, uint8_t num_stages) {
+    bool_t ret = FALSE;
+    if ((filter != NULL) && (coefs != NULL) && (state != NULL) && (num_stages > 0)) {
+        filter->coefs = coefs;
+        filter->state = state;
+        filter->num_stages = num_stages;
+        BIQUAD_Reset(filter);
+        ret = TRUE;
+    }
+    return ret;
+}
+
+void BIQUAD_Reset(biquad_t *filter) {
+    memset(filter->state, 0, filter->num_stages * BIQUAD_STATE_PER_STAGE * sizeof(int32_t));
+}
+
+int32_t BIQUAD_Step(biquad_t *filter, int32_t input) {
+    const int32_t *coef = filter->coefs;
+    int32_t *state = filter->state;
+    int32_t x = input;
+
+    for (uint8_t stage = 0; stage < filter->num_stages; stage++) {
+        x = StageUpdate(MUL_ELEMENTS_64(coef[0], x), MUL_ELEMENTS_64(coef[1], x), MUL_ELEMENTS_64(coef[2], x),
+                        coef[3], coef[4], &state[0], &state[1]);
+        coef += BIQUAD_COEFS_PER_STAGE;
+        state += BIQUAD_STATE_PER_STAGE;
+    }
+
+    return x;
+}
+
+int32_t BIQUAD_StepQ15(biquad_t *filter, int32_t input) {
+    int32_t input_q31 = Saturate32((int64_t)input * (1LL << Q15_TO_Q31_SHIFT));
+    return BIQUAD_Step(filter, input_q31) >> Q15_TO_Q31_SHIFT;
+}
+
+void BIQUAD_StepBlock(biquad_t *filter, const int32_t *input, int32_t *output, size_t size) {
+    const int32_t *coef = filter->coefs;
+    int32_t *state = filter->state;
+    const int32_t *x = input;
+
+    /* Section by section over the whole block, the output buffer carries the intermediate signal */
+    for (uint8_t stage = 0; stage < filter->num_stages; stage++) {
+        StageBlock(coef, state, x, output, size);
+        x = output;
+        coef += BIQUAD_COEFS_PER_STAGE;
+        state += BIQUAD_STATE_PER_STAGE;
+    }
+}
+
+void BIQUAD_StepBlockQ15(biquad_t *filter, const int32_t *input, int32_t *output, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        output[i] = Saturate32((int64_t)input[i] * (1LL << Q15_TO_Q31_SHIFT));
+    }
+    BIQUAD_StepBlock(filter, output, output, size);
+    for (size_t i = 0; i < size; i++) {
+        output[i] >>= Q15_TO_Q31_SHIFT;
+    }
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+__STATIC_FORCEINLINE int32_t Saturate32(int64_t value) {
+    if (value > INT32_MAX) {
+        value = INT32_MAX;
+    }
+    else if (value < INT32_MIN) {
+        value = INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
+__STATIC_FORCEINLINE int32_t AccToQ31(int64_t acc) {
+    return Saturate32((acc + ACC_ROUND) >> BIQUAD_COEF_SHIFT);
+}
+
+__STATIC_FORCEINLINE int32_t StageUpdate(int64_t p0, int64_t p1, int64_t p2, int32_t a1, int32_t a2, int32_t *s1, int32_t *s2) {
+    /* y = b0 x + s1 */
+    int32_t y = AccToQ31(p0 + STATE_TO_ACC(*s1));
+
+    /* s1 = b1 x - a1 y + s2 */
+    *s1 = AccToQ31(p1 - MUL_ELEMENTS_64(a1, y) + STATE_TO_ACC(*s2));
+
+    /* s2 = b2 x - a2 y */
+    *s2 = AccToQ31(p2 - MUL_ELEMENTS_64(a2, y));
+
+    return y;
+}
+
+#if BLOCK_USE_SIMD
+
+static void StageBlock(const int32_t *coef, int32_t *state, const int32_t *input, int32_t *output, size_t size) {
+    int64_t p0[BLOCK_CHUNK];
+    int64_t p1[BLOCK_CHUNK];
+    int64_t p2[BLOCK_CHUNK];
+    int32_t s1 = state[0];
+    int32_t s2 = state[1];
+
+    while (size > 0) {
+        size_t chunk = (size < BLOCK_CHUNK) ? size : BLOCK_CHUNK;
+        /* The whole chunk is read before it is written, so input may alias output */
+        FeedForwardChunk(coef, input, chunk, p0, p1, p2);
+        for (size_t i = 0; i < chunk; i++) {
+            output[i] = StageUpdate(p0[i], p1[i], p2[i], coef[3], coef[4], &s1, &s2);
+        }
+        input += chunk;
+        output += chunk;
+        size -= chunk;
+    }
+
+    state[0] = s1;
+    state[1] = s2;
+}
+
+static void FeedForwardChunk(const int32_t *coef, const int32_t *input, size_t size, int64_t *p0, int64_t *p1, int64_t *p2) {
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i b0 = _mm256_set1_epi64x(coef[0]);
+    __m256i b1 = _mm256_set1_epi64x(coef[1]);
+    __m256i b2 = _mm256_set1_epi64x(coef[2]);
+    for (; (i + 4) <= size; i += 4) {
+        __m256i x = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i *)&input[i]));
+        _mm256_storeu_si256((__m256i *)&p0[i], _mm256_mul_epi32(x, b0));
+        _mm256_storeu_si256((__m256i *)&p1[i], _mm256_mul_epi32(x, b1));
+        _mm256_storeu_si256((__m256i *)&p2[i], _mm256_mul_epi32(x, b2));
+    }
+#else
+    __m128i b0 = _mm_set1_epi64x(coef[0]);
+    __m128i b1 = _mm_set1_epi64x(coef[1]);
+    __m128i b2 = _mm_set1_epi64x(coef[2]);
+    for (; (i + 2) <= size; i += 2) {
+        __m128i x = _mm_cvtepi32_epi64(_mm_loadl_epi64((const __m128i *)&input[i]));
+        _mm_storeu_si128((__m128i *)&p0[i], _mm_mul_epi32(x, b0));
+        _mm_storeu_si128((__m128i *)&p1[i], _mm_mul_epi32(x, b1));
+        _mm_storeu_si128((__m128i *)&p2[i], _mm_mul_epi32(x, b2));
+    }
+#endif
+    for (; i < size; i++) {
+        p0[i] = MUL_ELEMENTS_64(coef[0], input[i]);
+        p1[i] = MUL_ELEMENTS_64(coef[1], input[i]);
+        p2[i] = MUL_ELEMENTS_64(coef[2], input[i]);
+    }
+}
+
+#else
+
+static void StageBlock(const int32_t *coef, int32_t *state, const int32_t *input, int32_t *output, size_t size) {
+    /* Coefficients and state stay in registers for the whole block. On the
+     * Cortex-M4 the products map to SMULL/SMLAL: the dual 16 bit SMLAD cannot
+     * be used without truncating the Q2.30 coefficients. */
+    int32_t b0 = coef[0];
+    int32_t b1 = coef[1];
+    int32_t b2 = coef[2];
+    int32_t a1 = coef[3];
+    int32_t a2 = coef[4];
+    int32_t s1 = state[0];
+    int32_t s2 = state[1];
+
+    for (size_t i = 0; i < size; i++) {
+        int32_t x = input[i];
+        output[i] = StageUpdate(MUL_ELEMENTS_64(b0, x), MUL_ELEMENTS_64(b1, x), MUL_ELEMENTS_64(b2, x), a1, a2, &s1, &s2);
+    }
+
+    state[0] = s1;
+    state[1] = s2;
+}
+
+#endif
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,167 @@
+/**
+ * @file bode.c
+ * @author Marcos Dominguez
+ *
+ * @brief Stepped sine measurement of the frequency response of the plant.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "bode.h"
+#include "interface.h"
+#include "excitation.h"
+#include "goertzel.h"
+#include "control_config.h"
+#include "osal_task.h"
+#include "sapi.h"
+#include "task_manager.h"
+#include <math.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define SAMPLE_RATE     (1000.0f / TS_MS)
+
+#define AMPLITUDE       0.5f        /**< Sine between 0.5 V and 1.5 V. */
+#define OFFSET          1.0f
+
+#define SETTLE_SAMPLES  200         /**< 1 s for the transient of each step, the plant settles in about 0.3 s. */
+#define MIN_CYCLES      4           /**< Cycles measured at the lowest frequencies. */
+#define MIN_SAMPLES     400         /**< Samples measured at the highest ones, to average the noise. */
+
+#define RAD_TO_DEG      57.2957795130823208768f
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/**
+ * @brief Excite the plant every 5 ms and measure one frequency after the other.
+ */
+STATIC void BODE_Sweep(void *not_used);
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Load the sine and the filters of a frequency.
+ *
+ * The frequency is moved to fit an integer number of cycles in the
+ * measurement, so the offsets do not leak into the bins.
+ *
+ * @param frequency Requested frequency, in Hz.
+ */
+static void start_step(float frequency);
+
+/**
+ * @brief Print the gain and the phase of the frequency just measured.
+ */
+static void print_step(void);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static const float frequencies[] = {0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f, 32.0f, 64.0f};
+
+static excitation_t excitation;
+
+static goertzel_t u_bin;            /**< Input applied */
+
+static goertzel_t y_bin;            /**< Output measured */
+
+static float step_frequency;        /**< Frequency being measured, in Hz */
+
+static uint32_t step_samples;       /**< Samples measured after the settling ones */
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+void BODE_Init(void) {
+    static osal_task_t bode_task = {.name = "bode"};
+    static osal_stack_holder_t bode_stack[STACK_SIZE_BODE];
+    static osal_task_holder_t bode_holder;
+    OSAL_TASK_LoadStruct(&bode_task, bode_stack, &bode_holder, STACK_SIZE_BODE);
+    OSAL_TASK_Create(&bode_task, BODE_Sweep, NULL, TASK_PRIORITY_NORMAL);
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+STATIC void BODE_Sweep(void *not_used) {
+    static uint8_t index = 0;
+    static uint32_t count = 0;
+    STATIC osal_tick_t last_wake;
+    static bool_t started = FALSE;
+
+    if (!started) {
+        INTERFACE_Init();
+        uartWriteString(UART_USB, "Frequency response:\n");
+        start_step(frequencies[index]);
+        OSAL_TASK_Delay(2000);
+        last_wake = OSAL_TASK_GetTickCount();
+        started = TRUE;
+    }
+
+    #ifndef TEST
+    while (TRUE)
+    #endif
+    {
+        float u_k = EXCITATION_Next(&excitation);
+        uint16_t u_mv = (uint16_t)(u_k * 1000);
+        INTERFACE_DACWriteMv(u_mv);
+        float y_k = (float)INTERFACE_ADCRead(1) / 1000.0f;
+
+        if (count >= SETTLE_SAMPLES) {
+            // Without the offsets the states stay small and keep their resolution
+            GOERTZEL_Update(&u_bin, ((float)u_mv / 1000.0f) - OFFSET);
+            GOERTZEL_Update(&y_bin, y_k - OFFSET);
+        }
+        count++;
+
+        if (count == (SETTLE_SAMPLES + step_samples)) {
+            print_step();
+            index++;
+            if (index == (sizeof(frequencies) / sizeof(frequencies[0]))) {
+                index = 0;
+                uartWriteString(UART_USB, "Frequency response:\n");
+            }
+            start_step(frequencies[index]);
+            count = 0;
+        }
+
+        OSAL_TASK_DelayUntil(&last_wake, OSAL_MS_TO_TICKS(TS_MS));
+    }
+}
+
+static void start_step(float frequency) {
+    uint32_t cycles = (uint32_t)ceilf(MIN_SAMPLES * frequency / SAMPLE_RATE);
+    if (cycles < MIN_CYCLES) {
+        cycles = MIN_CYCLES;
+    }
+    step_samples = (uint32_t)lroundf(cycles * SAMPLE_RATE / frequency);
+    step_frequency = cycles * SAMPLE_RATE / step_samples;
+
+    EXCITATION_MultisineInit(&excitation, &step_frequency, 1, SAMPLE_RATE, AMPLITUDE, OFFSET);
+    GOERTZEL_Init(&u_bin, step_frequency, SAMPLE_RATE);
+    GOERTZEL_Init(&y_bin, step_frequency, SAMPLE_RATE);
+}
+
+static void print_step(void) {
+    static char str[100];
+    float u_re, u_im, y_re, y_im;
+    GOERTZEL_Result(&u_bin, &u_re, &u_im);
+    GOERTZEL_Result(&y_bin, &y_re, &y_im);
+
+    // H = Y / U
+    float u_mag2 = (u_re * u_re) + (u_im * u_im);
+    float h_re = ((y_re * u_re) + (y_im * u_im)) / u_mag2;
+    float h_im = ((y_im * u_re) - (y_re * u_im)) / u_mag2;
+
+    sprintf(str, "F = %f Hz, GAIN = %f dB, PHASE = %f deg\n", step_frequency,
+            20.0f * log10f(sqrtf((h_re * h_re) + (h_im * h_im))), RAD_TO_DEG * atan2f(h_im, h_re));
+    uartWriteString(UART_USB, str);
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -14,15 +14,11 @@
 #include "interface.h"
 #include "task_manager.h"
 #include "pid.h"
+#include "discretize.h"
+#include "telemetry.h"
+#include "osal_profiler.h"
 
-#include <stdio.h>
 #include <string.h>
-#ifndef TEST
-#include "sapi.h"
-#else
-#define UART_USB 1
-#define uartWriteString(UART_USB, str) printf("%s",str)
-#endif
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
 
@@ -34,23 +30,42 @@
 #define CONTROL_TASK PID_CONTROL
 
 #define V_TO_MV(x)  ((x) * 1000)
+#define ACTION_MAX_MV   3300    /**< Full scale of the DAC. */
 #define N_SAMPLES (1 << 8)
-#define TS_MS         5
 
 
 #define MUL_ELEMENTS(x,y)  ((x)*(y))
 
-#define ERROR(r,x) (2 * (r) - (x))
+/* Identified model of the plant used by the observer, in controllable canonical form */
+#define MODEL_A11   (-DISCRETIZE_ZOH_2POLE_A1(MODEL_POLE_1, MODEL_POLE_2, CONTROL_TS))
+#define MODEL_A12   (-DISCRETIZE_ZOH_2POLE_A2(MODEL_POLE_1, MODEL_POLE_2, CONTROL_TS))
+#define MODEL_A21   1.0
+#define MODEL_A22   0.0
+#define MODEL_B1    1.0
+#define MODEL_B2    0.0
+#define MODEL_C1    DISCRETIZE_ZOH_2POLE_B1(MODEL_POLE_1, MODEL_POLE_2, MODEL_DC_GAIN, CONTROL_TS)
+#define MODEL_C2    DISCRETIZE_ZOH_2POLE_B2(MODEL_POLE_1, MODEL_POLE_2, MODEL_DC_GAIN, CONTROL_TS)
+
+#if (TS_MS == 5)
+#define MODEL_KO    1.47229047      /**< Tuned on the rig, DISCRETIZE_REFERENCE_GAIN gives the model based value */
+#else
+#define MODEL_KO    DISCRETIZE_REFERENCE_GAIN(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, MODEL_C1, MODEL_C2, \
+                                              DISCRETIZE_ACKERMANN_K1(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2), \
+                                              DISCRETIZE_ACKERMANN_K2(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2))
+#endif
+
+#if (TS_MS != 5) && (CONTROL_TASK == POLE_PLACEMENT)
+#error "The gains of CONTROLLER_PolePlacementControl were designed on the measured states at TS_MS 5"
+#endif
+
+#define CONTROL_C1  DISCRETIZE_POLY_C1(CONTROL_POLE_1, CONTROL_POLE_2)
+#define CONTROL_C2  DISCRETIZE_POLY_C2(CONTROL_POLE_1, CONTROL_POLE_2)
+
+#define OBSERVER_C1 DISCRETIZE_POLY_C1(OBSERVER_POLE_1, OBSERVER_POLE_2)
+#define OBSERVER_C2 DISCRETIZE_POLY_C2(OBSERVER_POLE_1, OBSERVER_POLE_2)
 
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
-typedef struct {
-    double A[2][2];
-    double B[2];
-    double C[2];
-	double K[2];
-	double Ko;
-} pole_placement_config_t;
 
 /*========= [TASK DECLARATIONS] ================================================*/
 
@@ -66,7 +81,17 @@ static void CONTROLLER_PolePlacementControlObserver(void *per);
 
 STATIC int32_t PidRecurrenceFunction(int32_t input);
 
-STATIC double PolePlacementControl(pole_placement_config_t *config, double state[2], double reference);
+/**
+ * @brief Run the hook, if any.
+ *
+ * @return int32_t  Offset in mV for the next sample, 0 without hook.
+ */
+static int32_t RunHook(int32_t u_mv, int32_t y_mv);
+
+/**
+ * @brief Saturate an action to the range of the DAC, the value the plant gets.
+ */
+static uint16_t ClampAction(int32_t u_mv);
 
 // STATIC void MatrixMultiply(double **AB, double **A, double **B, int M, int N, int L);
 
@@ -76,12 +101,42 @@ STATIC double PolePlacementControl(pole_placement_config_t *config, double state
 
 STATIC uint16_t input_mv = 0;
 
+STATIC osal_profiler_t controller_profiler; /**< Timing of the running controller. */
+
+STATIC const controller_observer_tuning_t observer_default_tuning = {
+    .model = {
+        .A = {
+            [0] = {STATE_SPACE_REAL(MODEL_A11), STATE_SPACE_REAL(MODEL_A12)},
+            [1] = {STATE_SPACE_REAL(MODEL_A21), STATE_SPACE_REAL(MODEL_A22)},
+        },
+        .B = {{STATE_SPACE_REAL(MODEL_B1)}, {STATE_SPACE_REAL(MODEL_B2)}},
+        .C = {{STATE_SPACE_REAL(MODEL_C1), STATE_SPACE_REAL(MODEL_C2)}},
+        .L = {
+            {STATE_SPACE_REAL(DISCRETIZE_OBSERVER_L1(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_C1, MODEL_C2, OBSERVER_C1, OBSERVER_C2))},
+            {STATE_SPACE_REAL(DISCRETIZE_OBSERVER_L2(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_C1, MODEL_C2, OBSERVER_C1, OBSERVER_C2))},
+        },
+    },
+    .gain = {
+        .K = {{
+            STATE_SPACE_REAL(DISCRETIZE_ACKERMANN_K1(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2)),
+            STATE_SPACE_REAL(DISCRETIZE_ACKERMANN_K2(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2)),
+        }},
+        .Ko = {{STATE_SPACE_REAL(MODEL_KO)}},
+    },
+};
+
+STATIC const controller_observer_tuning_t *observer_tuning = &observer_default_tuning;  /**< Active tuning, swapped atomically. */
+
+static controller_hook_t hook = NULL;   /**< Sampling and excitation from outside, swapped atomically. */
+
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
 void CONTROLLER_Init(void) {
     INTERFACE_Init();
+    TELEMETRY_Init();
+    OSAL_PROFILER_Init(&controller_profiler, TS_MS * 1000, TS_MS * 1000);
     static uint8_t period = PERIODO_SQUARE;
     static osal_task_t controller_task = {.name = "controller"};
     static osal_stack_holder_t controller_stack[STACK_SIZE_CONTROLLER];
@@ -105,22 +160,24 @@ STATIC void CONTROLLER_SquareOpenLoop(void *per) {
     osal_tick_t last_enter_to_task = OSAL_TASK_GetTickCount();
     static uint8_t r_index = 0;
     static uint32_t count = 0;
+    static int32_t offset_mv = 0;
     #ifndef TEST
     while (TRUE)
     #endif
     {   
-        uint16_t u = output[r_index];
+        OSAL_PROFILER_Begin(&controller_profiler);
+        uint16_t u = ClampAction(output[r_index] + offset_mv);
         INTERFACE_DACWriteMv(u);
         input_mv = INTERFACE_ADCRead(1);
+        offset_mv = RunHook(u, input_mv);
 
         count++;
         if (count >= ((period * 1000 / 2) / TS_MS)) {
             count = 0;
             r_index ^= 1;
         }
-        static char str[150];
-        sprintf(str,"%d,%d,%d,%.d\n",OSAL_TASK_GetTickCount(), u, u, input_mv);
-        uartWriteString(UART_USB, str);
+        TELEMETRY_Push(OSAL_TASK_GetTickCount(), u, u, input_mv);
+        OSAL_PROFILER_End(&controller_profiler);
         OSAL_TASK_DelayUntil(&last_enter_to_task, OSAL_MS_TO_TICKS(TS_MS));
     }
 }
@@ -133,45 +190,47 @@ STATIC void CONTROLLER_PID(void *per) {
 
     static uint8_t r_index = 0;
     static uint32_t count = 0;
+    static int32_t offset_mv = 0;
     osal_tick_t last_enter_to_task = OSAL_TASK_GetTickCount();
 
     #ifndef TEST
     while (TRUE)
     #endif
     {   
+        OSAL_PROFILER_Begin(&controller_profiler);
         input_mv = INTERFACE_ADCRead(1);
         uint32_t input_q15 = (Q15_SCALE(input_mv)) / 3300;
-        uint32_t u = PID_Filter(ERROR(r[r_index],input_q15));
+        int32_t u_q15 = PID_Step(r[r_index], input_q15);
         reference = (r[r_index] * 3300) >> 15;
-        u = (u * 3300) >> 15;
+        uint16_t u = ClampAction((int32_t)(((int64_t)u_q15 * 3300) >> 15) + offset_mv);
         INTERFACE_DACWriteMv(u);
+        offset_mv = RunHook(u, input_mv);
 
         count++;
         if (count >= ((period * 1000 / 2) / TS_MS)) {
             count = 0;
             r_index ^= 1;
         }
-        static char str[150];
-        sprintf(str,"%d,%d,%d,%.d\n",OSAL_TASK_GetTickCount(), reference, u, input_mv);
-        uartWriteString(UART_USB, str);
+        TELEMETRY_Push(OSAL_TASK_GetTickCount(), reference, u, input_mv);
         
+        OSAL_PROFILER_End(&controller_profiler);
         OSAL_TASK_DelayUntil(&last_enter_to_task, OSAL_MS_TO_TICKS(TS_MS));
     }
 }
 
 static void CONTROLLER_PolePlacementControl(void *per) {
-	pole_placement_config_t pole_placement_config;
-
-    pole_placement_config.K[0] = 0.4881977;
-    pole_placement_config.K[1] = 0.6236087;
-    pole_placement_config.Ko = 2.115;
+    static const pole_placement_gain_t gain = {
+        .K = {{STATE_SPACE_REAL(0.4881977), STATE_SPACE_REAL(0.6236087)}},
+        .Ko = {{STATE_SPACE_REAL(2.115)}},
+    };
 
     uint8_t period = *((uint8_t *) per);
 
-    static const double r[2] = {2.0, 1.0};
+    static const state_space_real_t r[2] = {STATE_SPACE_REAL(2.0), STATE_SPACE_REAL(1.0)};
 
     static uint8_t r_index = 0;
     static uint32_t count = 0;
+    static int32_t offset_mv = 0;
     
     osal_tick_t last_enter_to_task = OSAL_TASK_GetTickCount();
 
@@ -179,110 +238,118 @@ static void CONTROLLER_PolePlacementControl(void *per) {
     while (TRUE)
     #endif
     {   
-        static double state[2];
+        OSAL_PROFILER_Begin(&controller_profiler);
+        state_space_real_t state[POLE_PLACEMENT_STATES];
 
-        state[0] = (double)(INTERFACE_ADCRead(1)/1000.0);
-        state[1] = (double)(INTERFACE_ADCRead(2)/1000.0);
+        int32_t y_mv = INTERFACE_ADCRead(1);
+        state[0] = STATE_SPACE_FromMv(y_mv);
+        state[1] = STATE_SPACE_FromMv(INTERFACE_ADCRead(2));
 
-        double voltage = PolePlacementControl(&pole_placement_config, state, r[r_index]);
-        uint16_t u = (uint16_t)(voltage * 1000);
+        state_space_real_t voltage;
+        POLE_PLACEMENT_Control(&gain, state, &r[r_index], &voltage);
+        uint16_t u = ClampAction(STATE_SPACE_ToMv(voltage) + offset_mv);
         
         INTERFACE_DACWriteMv(u);
+        offset_mv = RunHook(u, y_mv);
 
         count++;
         if (count >= ((period * 1000 / 2) / TS_MS)) {
             count = 0;
             r_index ^= 1;
         }
-        static char str[150];
-        sprintf(str,"%d,%d,%d,%.d\n", OSAL_TASK_GetTickCount(), (uint16_t)(r[r_index]*1000), u, INTERFACE_ADCRead(1));
-        uartWriteString(UART_USB, str);
+        TELEMETRY_Push(OSAL_TASK_GetTickCount(), (uint16_t)STATE_SPACE_ToMv(r[r_index]), u, INTERFACE_ADCRead(1));
         
+        OSAL_PROFILER_End(&controller_profiler);
         OSAL_TASK_DelayUntil(&last_enter_to_task, OSAL_MS_TO_TICKS(TS_MS));
     }
 }
 
 static void CONTROLLER_PolePlacementControlObserver(void *per) {
-	static pole_placement_config_t pole_placement_config ={
-       .A = {
-           [0] = { 1.24881977, -0.33763913},
-           [1] = { 1.,0.}
-           },
-       .B = {1, 0},
-       .C = {0.05233013, 0.03648923},
-       .K = {0.04881977, 0.06236087},
-       .Ko = 2.2517611841175635
-    };
+    static pole_placement_t observer;
+
+    uint8_t period = *((uint8_t *) per);
 
-   pole_placement_config.K[0] = 1.3581298;
-   pole_placement_config.K[1] = -0.9386444;
-   pole_placement_config.Ko = 1.47229047;
-   static const double L[2] = {-4.64320567, -12.13743388};
-   uint8_t period = *((uint8_t *) per);
+    static const state_space_real_t r[2] = {STATE_SPACE_REAL(2.0), STATE_SPACE_REAL(1.0)};
 
-   static const double r[2] = {2.0, 1.0};
+    static uint8_t r_index = 0;
+    static uint32_t count = 0;
+    static int32_t offset_mv = 0;
 
-   static uint8_t r_index = 0;
-   static uint32_t count = 0;
+    osal_tick_t last_enter_to_task = OSAL_TASK_GetTickCount();
 
-   osal_tick_t last_enter_to_task = OSAL_TASK_GetTickCount();
+    if (observer.model == NULL) {
+        POLE_PLACEMENT_Init(&observer, &observer_default_tuning.model);
+    }
 
     #ifndef TEST
     while (TRUE)
     #endif
     {
-        static double x_est[2] = {0,0};
-        static double x_est_tempA[2] = {0,0};
-        static double x_est_tempB[2] = {0,0};
-        static double x_est_tempC[2] = {0, 0};
-
-        double y = (double)(INTERFACE_ADCRead(1)/1000.0);
-
-
-        double u = PolePlacementControl(&pole_placement_config, x_est, r[r_index]);
-
-        uint16_t u_dac = (uint16_t)(u * 1000);
-
-        INTERFACE_DACWriteMv(u_dac);
-
-            
-        for (int i = 0; i < 2; i++) {
-            x_est_tempA[i] = 0;
-            for (int j = 0; j < 2; j++) {
-                x_est_tempA[i] += MUL_ELEMENTS(pole_placement_config.A[i][j], x_est[j]);
-            }
+        OSAL_PROFILER_Begin(&controller_profiler);
+        const controller_observer_tuning_t *tuning = __atomic_load_n(&observer_tuning, __ATOMIC_ACQUIRE);
+        observer.model = &tuning->model;
+        int32_t y_mv = INTERFACE_ADCRead(1);
+        state_space_real_t y = STATE_SPACE_FromMv(y_mv);
+
+        state_space_real_t u;
+        POLE_PLACEMENT_Control(&tuning->gain, observer.x, &r[r_index], &u);
+
+        int32_t u_mv = ClampAction(STATE_SPACE_ToMv(u) + offset_mv);
+        if (u_mv != STATE_SPACE_ToMv(u)) {
+            u = STATE_SPACE_FromMv(u_mv);   // The observer is fed the action applied
         }
 
-        x_est_tempB[0] = MUL_ELEMENTS(pole_placement_config.B[0], u);
-        x_est_tempB[1] = MUL_ELEMENTS(pole_placement_config.B[1], u);
-        double cx_est  = MUL_ELEMENTS(pole_placement_config.C[0], x_est[0]) + MUL_ELEMENTS(pole_placement_config.C[1], x_est[1]);
-        x_est_tempC[0] = MUL_ELEMENTS(L[0], (y - cx_est));
-        x_est_tempC[1] = MUL_ELEMENTS(L[1], (y - cx_est));
+        INTERFACE_DACWriteMv((uint16_t)u_mv);
+        offset_mv = RunHook(u_mv, y_mv);
 
-        x_est[0] = (x_est_tempA[0] + x_est_tempB[0] + x_est_tempC[0]);
-        x_est[1] = (x_est_tempA[1] + x_est_tempB[1] + x_est_tempC[1]);
+        POLE_PLACEMENT_Update(&observer, &u, &y);
 
         count++;
         if (count >= ((period * 1000 / 2) / TS_MS)) {
             count = 0;
             r_index ^= 1;
         }
-        static char str[150];
-        //    sprintf(str,"%d - %d - %f - %f\n", (uint16_t)(r[r_index]*1000), u, x_est[0],x_est[1]);
-        sprintf(str,"%d,%d,%d,%.d\n", OSAL_TASK_GetTickCount(), (uint16_t)(r[r_index]*1000), (int32_t)(u * 1000), ((int32_t)INTERFACE_ADCRead(1)));
-
-        uartWriteString(UART_USB, str);
+        TELEMETRY_Push(OSAL_TASK_GetTickCount(), (uint16_t)STATE_SPACE_ToMv(r[r_index]), u_mv, INTERFACE_ADCRead(1));
 
+        OSAL_PROFILER_End(&controller_profiler);
         OSAL_TASK_DelayUntil(&last_enter_to_task, OSAL_MS_TO_TICKS(TS_MS));
     }
 }
 
 
+bool_t CONTROLLER_GetTiming(osal_profiler_t *snapshot) {
+    return OSAL_PROFILER_Get(&controller_profiler, snapshot);
+}
+
+void CONTROLLER_SetObserverTuning(const controller_observer_tuning_t *tuning) {
+    __atomic_store_n(&observer_tuning, (tuning != NULL) ? tuning : &observer_default_tuning, __ATOMIC_RELEASE);
+}
+
+void CONTROLLER_SetHook(controller_hook_t new_hook) {
+    __atomic_store_n(&hook, new_hook, __ATOMIC_RELEASE);
+}
+
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
-double PolePlacementControl(pole_placement_config_t *config, double state[2], double reference) {
-    double Ko = config->Ko;
-	return ((Ko * reference) - (config->K[0] * state[0] + config->K[1] * state[1]));
+static int32_t RunHook(int32_t u_mv, int32_t y_mv) {
+    int32_t offset_mv = 0;
+    controller_hook_t current = __atomic_load_n(&hook, __ATOMIC_ACQUIRE);
+    if (current != NULL) {
+        offset_mv = current(u_mv, y_mv);
+    }
+
+    return offset_mv;
+}
+
+static uint16_t ClampAction(int32_t u_mv) {
+    if (u_mv < 0) {
+        u_mv = 0;
+    }
+    else if (u_mv > ACTION_MAX_MV) {
+        u_mv = ACTION_MAX_MV;
+    }
+
+    return (uint16_t)u_mv;
 }
 
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
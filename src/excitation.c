@@ -0,0 +1,236 @@
+/**
+ * @file excitation.c
+ * @author Marcos Dominguez
+ *
+ * @brief Excitation signals for the identification experiments.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "excitation.h"
+#include <math.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define TWO_PI  6.28318530717958647692f
+#define PI      3.14159265358979323846f
+
+#define LOW_BITS(n) ((1UL << (n)) - 1)
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Keep a phase in [-pi, pi) so sinf keeps its precision over long experiments.
+ */
+static float WrapPhase(float phase);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/**
+ * @brief Low terms of a primitive polynomial of each length.
+ *
+ * Bit t set means the sequence follows s[k + length] = XOR of s[k + t]. The
+ * highest low term is kept small, so the length minus it bits are generated
+ * at once. Every polynomial was checked to be primitive, so the period is
+ * 2^length - 1.
+ */
+static const uint32_t prbs_taps[EXCITATION_PRBS_MAX_LENGTH - EXCITATION_PRBS_MIN_LENGTH + 1] = {
+    0x00000003u,   /*  3: x^3 + x + 1 */
+    0x00000003u,   /*  4: x^4 + x + 1 */
+    0x00000005u,   /*  5: x^5 + x^2 + 1 */
+    0x00000003u,   /*  6: x^6 + x + 1 */
+    0x00000003u,   /*  7: x^7 + x + 1 */
+    0x0000001Du,   /*  8: x^8 + x^4 + x^3 + x^2 + 1 */
+    0x00000011u,   /*  9: x^9 + x^4 + 1 */
+    0x00000009u,   /* 10: x^10 + x^3 + 1 */
+    0x00000005u,   /* 11: x^11 + x^2 + 1 */
+    0x00000053u,   /* 12: x^12 + x^6 + x^4 + x + 1 */
+    0x0000001Bu,   /* 13: x^13 + x^4 + x^3 + x + 1 */
+    0x0000002Bu,   /* 14: x^14 + x^5 + x^3 + x + 1 */
+    0x00000003u,   /* 15: x^15 + x + 1 */
+    0x0000002Du,   /* 16: x^16 + x^5 + x^3 + x^2 + 1 */
+    0x00000009u,   /* 17: x^17 + x^3 + 1 */
+    0x00000027u,   /* 18: x^18 + x^5 + x^2 + x + 1 */
+    0x00000027u,   /* 19: x^19 + x^5 + x^2 + x + 1 */
+    0x00000009u,   /* 20: x^20 + x^3 + 1 */
+    0x00000005u,   /* 21: x^21 + x^2 + 1 */
+    0x00000003u,   /* 22: x^22 + x + 1 */
+    0x00000021u,   /* 23: x^23 + x^5 + 1 */
+    0x0000001Bu,   /* 24: x^24 + x^4 + x^3 + x + 1 */
+    0x00000009u,   /* 25: x^25 + x^3 + 1 */
+    0x00000047u,   /* 26: x^26 + x^6 + x^2 + x + 1 */
+    0x00000027u,   /* 27: x^27 + x^5 + x^2 + x + 1 */
+    0x00000009u,   /* 28: x^28 + x^3 + 1 */
+    0x00000005u,   /* 29: x^29 + x^2 + 1 */
+    0x00000053u,   /* 30: x^30 + x^6 + x^4 + x + 1 */
+    0x00000009u,   /* 31: x^31 + x^3 + 1 */
+    0x000000C5u,   /* 32: x^32 + x^7 + x^6 + x^2 + 1 */
+};
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t EXCITATION_PrbsInit(excitation_t *excitation, uint8_t length, uint16_t hold, uint32_t seed, float amplitude, float offset) {
+    bool_t ret = FALSE;
+    if (excitation != NULL) {
+        if ((length >= EXCITATION_PRBS_MIN_LENGTH) && (length <= EXCITATION_PRBS_MAX_LENGTH) && (hold > 0)) {
+            excitation_prbs_t *prbs = &excitation->prbs;
+            uint32_t mask = (length < 32) ? LOW_BITS(length) : 0xFFFFFFFFu;
+            uint32_t taps = prbs_taps[length - EXCITATION_PRBS_MIN_LENGTH];
+            uint8_t highest_tap = 31 - __builtin_clz(taps);
+
+            excitation->type = EXCITATION_PRBS;
+            excitation->amplitude = amplitude;
+            excitation->offset = offset;
+            prbs->state = ((seed & mask) != 0) ? (seed & mask) : 1;
+            prbs->taps = taps;
+            prbs->length = length;
+            prbs->stride = length - highest_tap;
+            prbs->bits_left = 0;
+            prbs->hold = hold;
+            prbs->hold_count = 0;
+            prbs->value = offset;
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+bool_t EXCITATION_MultisineInit(excitation_t *excitation, const float *frequency, uint8_t count, float sample_rate, float amplitude, float offset) {
+    bool_t ret = FALSE;
+    if ((excitation != NULL) && (frequency != NULL)) {
+        if ((count > 0) && (count <= EXCITATION_MAX_SINES) && (sample_rate > 0)) {
+            excitation->type = EXCITATION_MULTISINE;
+            excitation->amplitude = amplitude / count;
+            excitation->offset = offset;
+            excitation->multisine.count = count;
+            for (uint8_t i = 0; i < count; i++) {
+                // Schroeder phases, -pi k (k - 1) / count
+                excitation->multisine.phase[i] = WrapPhase(-PI * i * (i + 1) / count);
+                excitation->multisine.step[i] = WrapPhase(TWO_PI * frequency[i] / sample_rate);
+            }
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+bool_t EXCITATION_ChirpInit(excitation_t *excitation, float f_start, float f_end, uint32_t length, float sample_rate, float amplitude, float offset) {
+    bool_t ret = FALSE;
+    if (excitation != NULL) {
+        if ((length > 1) && (sample_rate > 0)) {
+            excitation->type = EXCITATION_CHIRP;
+            excitation->amplitude = amplitude;
+            excitation->offset = offset;
+            excitation->chirp.phase = 0;
+            excitation->chirp.step_start = TWO_PI * f_start / sample_rate;
+            excitation->chirp.step_increment = TWO_PI * (f_end - f_start) / (sample_rate * (length - 1));
+            excitation->chirp.length = length;
+            excitation->chirp.sample = 0;
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+float EXCITATION_Next(excitation_t *excitation) {
+    float ret = excitation->offset;
+
+    switch (excitation->type) {
+        case EXCITATION_PRBS: {
+            excitation_prbs_t *prbs = &excitation->prbs;
+            if (prbs->hold_count == 0) {
+                if (prbs->bits_left == 0) {
+                    prbs->word = EXCITATION_PrbsWord(prbs);
+                    prbs->bits_left = 32;
+                }
+                prbs->value = (prbs->word & 1) ? (excitation->offset + excitation->amplitude) : (excitation->offset - excitation->amplitude);
+                prbs->word >>= 1;
+                prbs->bits_left--;
+                prbs->hold_count = prbs->hold;
+            }
+            prbs->hold_count--;
+            ret = prbs->value;
+            break;
+        }
+
+        case EXCITATION_MULTISINE: {
+            excitation_multisine_t *multisine = &excitation->multisine;
+            float sum = 0;
+            for (uint8_t i = 0; i < multisine->count; i++) {
+                sum += sinf(multisine->phase[i]);
+                multisine->phase[i] = WrapPhase(multisine->phase[i] + multisine->step[i]);
+            }
+            ret += excitation->amplitude * sum;
+            break;
+        }
+
+        case EXCITATION_CHIRP: {
+            excitation_chirp_t *chirp = &excitation->chirp;
+            ret += excitation->amplitude * sinf(chirp->phase);
+            chirp->phase = WrapPhase(chirp->phase + chirp->step_start + chirp->step_increment * chirp->sample);
+            chirp->sample++;
+            if (chirp->sample >= chirp->length) {
+                chirp->sample = 0;
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    return ret;
+}
+
+uint32_t EXCITATION_PrbsWord(excitation_prbs_t *prbs) {
+    uint32_t word = 0;
+    uint8_t filled = 0;
+
+    while (filled < 32) {
+        uint8_t step = ((32 - filled) < prbs->stride) ? (32 - filled) : prbs->stride;
+        uint32_t mask = LOW_BITS(step);
+        uint32_t feedback = 0;
+        uint32_t taps = prbs->taps;
+
+        // step new bits at once, none of them depends on another new bit
+        while (taps != 0) {
+            uint8_t tap = __builtin_ctz(taps);
+            feedback ^= prbs->state >> tap;
+            taps &= taps - 1;
+        }
+        word |= (prbs->state & mask) << filled;
+        prbs->state = (prbs->state >> step) | ((feedback & mask) << (prbs->length - step));
+        filled += step;
+    }
+
+    return word;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static float WrapPhase(float phase) {
+    while (phase >= PI) {
+        phase -= TWO_PI;
+    }
+    while (phase < -PI) {
+        phase += TWO_PI;
+    }
+
+    return phase;
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
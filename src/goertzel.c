@@ -0,0 +1,63 @@
+/**
+ * @file goertzel.c
+ * @author Marcos Dominguez
+ *
+ * @brief Streaming single bin DFT.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "goertzel.h"
+#include <math.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define TWO_PI  6.28318530717958647692f
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t GOERTZEL_Init(goertzel_t *goertzel, float frequency, float sample_rate) {
+    bool_t ret = FALSE;
+    if (goertzel != NULL) {
+        if ((frequency > 0.0f) && (frequency < (sample_rate / 2.0f))) {
+            float w = TWO_PI * frequency / sample_rate;
+            goertzel->cos_w = cosf(w);
+            goertzel->sin_w = sinf(w);
+            goertzel->coef = 2.0f * goertzel->cos_w;
+            GOERTZEL_Reset(goertzel);
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+void GOERTZEL_Reset(goertzel_t *goertzel) {
+    goertzel->s1 = 0.0f;
+    goertzel->s2 = 0.0f;
+}
+
+void GOERTZEL_Result(const goertzel_t *goertzel, float *re, float *im) {
+    // y = s1 - e^(-j w) s2
+    *re = goertzel->s1 - (goertzel->cos_w * goertzel->s2);
+    *im = goertzel->sin_w * goertzel->s2;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -12,210 +12,421 @@
 
 #include "identificacion.h"
 #include "interface.h"
-#include <string.h>
+#include "arx.h"
+#include "excitation.h"
+#include "rls.h"
+#include "least_squares.h"
+#include "autotune.h"
+#include "control.h"
+#include "control_config.h"
+#include "osal_queue.h"
 #include "sapi.h"
 #include "task_manager.h"
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
-#define DATA_SIZE 400
+#define IDENTIFICACION_BATCH    0   /**< Fit every sample since start up, or the last BATCH_WINDOW blocks. */
+#define IDENTIFICACION_RLS      1   /**< Update the fit every sample, report once a block. */
 
-#define MUL_ELEMENTS(a, b) ((a)*(b))
+#define IDENTIFICACION_MODE IDENTIFICACION_RLS
+
+#define BATCH_WINDOW    0           /**< Blocks in the batch fit, 0 keeps every block. Each one costs a least_squares_t. */
+
+#if IDENTIFICACION_CLOSED_LOOP
+#define NUM_DELAY   (DEAD_TIME + 1)     /**< b0 is left out, u[k] is computed from y[k] and would bias it. */
+#define NUM_COEFS   ORDER
+#else
+#define NUM_DELAY   DEAD_TIME
+#define NUM_COEFS   (ORDER + 1)
+#endif
+
+#define NUM_PARAMS (ORDER + NUM_COEFS + NOISE_ORDER)   /**< a1 .. a_na, b .. , c1 .. c_nc */
+
+#if (NUM_PARAMS > ARX_MAX_PARAMS) || (NUM_PARAMS > RLS_MAX_PARAMS) || (NUM_PARAMS > LEAST_SQUARES_MAX_PARAMS)
+#error "ORDER and NOISE_ORDER exceed the parameters of the estimators"
+#endif
+
+#if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH) && (NOISE_ORDER > 0)
+#error "The ARMAX noise model needs the residuals of IDENTIFICACION_RLS"
+#endif
+
+#if IDENTIFICACION_AUTOTUNE && ((ORDER != 2) || (DEAD_TIME != 0) || (NOISE_ORDER != 0))
+#error "IDENTIFICACION_AUTOTUNE designs for a second order ARX model without dead time"
+#endif
+
+#if IDENTIFICACION_AUTOTUNE && !IDENTIFICACION_CLOSED_LOOP
+#error "IDENTIFICACION_AUTOTUNE retunes the running controller, it needs IDENTIFICACION_CLOSED_LOOP"
+#endif
+
+#define BLOCK_QTY       2           /**< One block is acquired while the other is estimated. */
+
+#define PRBS_LENGTH     16          /**< Period of 65535 samples, longer than any experiment. */
+#define PRBS_HOLD       1           /**< Samples each bit is held, raise it to move the band down. */
+#define PRBS_SEED       0xACE1u
+#define PRBS_AMPLITUDE  0.5f        /**< Steps between 0 V and 1 V. */
+#define PRBS_OFFSET     0.5f
+#define PRBS_ACTION_AMPLITUDE 0.1f  /**< In closed loop the PRBS is added to the action of the controller, +-0.1 V. */
+
+#define RLS_LAMBDA  0.995f          /**< Forgetting factor, about 200 samples (1 s) of memory. */
+#define RLS_P0      1000.0f         /**< Initial covariance, nothing known of the plant. */
+
+#define AUTOTUNE_MIN_BLOCKS 3       /**< Blocks fitted before the first design, 6 s. */
+#define AUTOTUNE_MAX_CHANGE 0.01f   /**< Largest change of theta from the previous block, relative to its norm. */
+#define AUTOTUNE_MAX_TRACE  100.0f  /**< RLS: largest trace of P, it starts at NUM_PARAMS * RLS_P0. */
 
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
+/**
+ * @brief Samples of one block, in mV as the DAC and the ADC use them.
+ */
+typedef struct {
+    int16_t u[MAX_SAMPLES];         /**< Input applied */
+    int16_t y[MAX_SAMPLES];         /**< Output measured */
+    uint32_t sequence;              /**< Block number since start up, a gap means blocks were dropped */
+} block_t;
+
+#if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH)
+typedef least_squares_t estimator_t;
+#elif (IDENTIFICACION_MODE == IDENTIFICACION_RLS)
+typedef rls_t estimator_t;
+#endif
+
 /*========= [TASK DECLARATIONS] ================================================*/
 
+#if !IDENTIFICACION_CLOSED_LOOP
+/**
+ * @brief Excite the plant and fill the blocks every TS_MS.
+ */
+STATIC void IDENTIFICACION_Acquire(void *not_used);
+#endif
+
+/**
+ * @brief Fit each full block while the next one is acquired.
+ */
+STATIC void IDENTIFICACION_Estimate(void *not_used);
+
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
-static void generate_prbs_signal(float *u, int size);
+/**
+ * @brief Store one sample in the block being filled and hand it to the estimation when full.
+ */
+static void store_sample(int16_t u_mv, int16_t y_mv);
 
-static void IdentificacionTask(void* not_used);
+#if IDENTIFICACION_CLOSED_LOOP
+/**
+ * @brief Sample the running controller and excite its action.
+ */
+static int32_t sample_controller(int32_t u_mv, int32_t y_mv);
+#endif
 
-static void acquire_output_signal(float *u, float *y, int size);
+/**
+ * @brief Polynomials of the fit, num always from b0 with the DEAD_TIME delay.
+ */
+static void get_polynomials(const float *theta, float *den, float *num, float *noise);
 
-static void InvertMatrix(float A[5][5], float A_inv[5][5]);
+static void print_parameters(const float *theta);
 
-static void LeastSquares(float *u, float *y, int size, float *a, float *b);
+#if IDENTIFICACION_AUTOTUNE
+/**
+ * @brief Design the controllers for the fit and publish them.
+ *
+ * @param theta Parameters of the fit.
+ */
+static void autotune(const float *theta);
 
-static void IdentificacionTask(void* not_used);
+/**
+ * @brief Decide if the fit settled enough to design from it. Call it once a block.
+ *
+ * @param theta     Parameters of the fit.
+ * @return bool_t   TRUE: Enough blocks, theta barely moved and, in RLS, P shrank - FALSE: Still converging.
+ */
+static bool_t converged(const float *theta);
+#endif
 
-static float q15_div(float a, float b);
+static void estimate_block(estimator_t *estimator, const block_t *block);
 
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
 
-STATIC float u[DATA_SIZE] = {[0 ... (DATA_SIZE - 1)] = 0}; // Entrada
+static arx_t arx;                   /**< Model structure and regressor, kept across blocks */
 
-STATIC float y[DATA_SIZE] = {[0 ... (DATA_SIZE - 1)] = 0}; // Salida
+static excitation_t excitation;
 
-/*========= [STATE FUNCTION POINTERS] ==========================================*/
+static estimator_t estimator;
 
-/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+static osal_queue_loan_t block_queue;   /**< Blocks filled in place by the acquisition and read in place by the estimation */
 
-void IDENTIFICACION_Init(void) {
-    static osal_task_t identificacion_task = {.name = "identificacion"};
-    static osal_stack_holder_t identificacion_stack[STACK_SIZE_IDENTIFICACION];
-    static osal_task_holder_t identificacion_holder;
-    OSAL_TASK_LoadStruct(&identificacion_task, identificacion_stack, &identificacion_holder, STACK_SIZE_IDENTIFICACION);
-    OSAL_TASK_Create(&identificacion_task, IdentificacionTask, NULL, TASK_PRIORITY_NORMAL);
-}
+#if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH) && (BATCH_WINDOW > 0)
+static least_squares_t window[BATCH_WINDOW];    /**< Sums of the last blocks, merged into the estimator */
 
+static uint8_t window_index = 0;    /**< Oldest block of the window */
+#endif
 
-/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+STATIC uint32_t blocks_dropped = 0; /**< Blocks overwritten because the estimation was late */
 
-static void IdentificacionTask(void* not_used) {
-    INTERFACE_Init();   
-    OSAL_TASK_Delay(2000);
-    float a[3], b[2];
+static block_t *fill_block = NULL;  /**< Block being filled */
 
+static uint16_t fill_samples = 0;   /**< Samples in the block being filled */
 
-    generate_prbs_signal(u, DATA_SIZE);
-    acquire_output_signal(u, y, DATA_SIZE);
-    LeastSquares(u, y, DATA_SIZE, a, b);
-    
-    static char str[150];
-    sprintf(str, "Identified system parameters:\n");
-    uartWriteString(UART_USB, str);
-    sprintf(str, "DEN0 = %f\nDEN1 = %f\nDEN2 = %f\n", a[0], a[1], a[2]);
-    uartWriteString(UART_USB, str);
-    sprintf(str, "NUM0 = %f\nNUM1 = %f\n", b[0], b[1]);
-    uartWriteString(UART_USB, str);
-
-    OSAL_TASK_Delay(OSAL_MAX_DELAY);
+static uint32_t fill_sequence = 0;  /**< Sequence of the block being filled */
 
-}
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
 
-// Función para dividir dos números Q15
-float q15_div(float a, float b) {
-    // Asegurarse de que no hay división por cero
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
-    return (float)(a / b);
+void IDENTIFICACION_Init(void) {
+    static osal_queue_holder_t block_holders[2];
+    static uint8_t block_index[OSAL_QUEUE_LoanIndexSize(BLOCK_QTY)];
+    static block_t blocks[BLOCK_QTY];
+
+    ARX_Init(&arx, ORDER, NUM_COEFS, NUM_DELAY, NOISE_ORDER);
+    #if IDENTIFICACION_CLOSED_LOOP
+    EXCITATION_PrbsInit(&excitation, PRBS_LENGTH, PRBS_HOLD, PRBS_SEED, PRBS_ACTION_AMPLITUDE, 0);
+    #else
+    EXCITATION_PrbsInit(&excitation, PRBS_LENGTH, PRBS_HOLD, PRBS_SEED, PRBS_AMPLITUDE, PRBS_OFFSET);
+    #endif
+    #if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH)
+    LEAST_SQUARES_Init(&estimator, NUM_PARAMS);
+    #if (BATCH_WINDOW > 0)
+    for (uint8_t i = 0; i < BATCH_WINDOW; i++) {
+        LEAST_SQUARES_Init(&window[i], NUM_PARAMS);
+    }
+    #endif
+    #elif (IDENTIFICACION_MODE == IDENTIFICACION_RLS)
+    RLS_Init(&estimator, NUM_PARAMS, RLS_LAMBDA, RLS_P0);
+    #endif
+
+    OSAL_QUEUE_LoanLoadStruct(&block_queue, block_holders, block_index, (uint8_t *)blocks, sizeof(block_t), BLOCK_QTY);
+    OSAL_QUEUE_LoanCreate(&block_queue);
+
+    #if IDENTIFICACION_CLOSED_LOOP
+    // The controller drives the DAC and the identification only samples it
+    CONTROLLER_SetHook(sample_controller);
+    CONTROLLER_Init();
+    #else
+    static osal_task_t acquire_task = {.name = "identificacion"};
+    static osal_stack_holder_t acquire_stack[STACK_SIZE_IDENTIFICACION];
+    static osal_task_holder_t acquire_holder;
+    OSAL_TASK_LoadStruct(&acquire_task, acquire_stack, &acquire_holder, STACK_SIZE_IDENTIFICACION);
+    OSAL_TASK_Create(&acquire_task, IDENTIFICACION_Acquire, NULL, TASK_PRIORITY_NORMAL);
+    #endif
+
+    static osal_task_t estimate_task = {.name = "estimacion"};
+    static osal_stack_holder_t estimate_stack[STACK_SIZE_ESTIMACION];
+    static osal_task_holder_t estimate_holder;
+    OSAL_TASK_LoadStruct(&estimate_task, estimate_stack, &estimate_holder, STACK_SIZE_ESTIMACION);
+    OSAL_TASK_Create(&estimate_task, IDENTIFICACION_Estimate, NULL, TASK_PRIORITY_LOW);
 }
 
-static void generate_prbs_signal(float *u, int size) {
-    uint16_t lfsr = 0xACE1u; // Estado inicial no nulo
-    uint16_t bit;
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
-    for (int i = 0; i < size; i++) {
-        // Generar el bit pseudo-aleatorio
-        bit = ((lfsr >> 0) ^ (lfsr >> 2) ^ (lfsr >> 3) ^ (lfsr >> 5)) & 1;
-        lfsr = (lfsr >> 1) | (bit << 15);
+#if !IDENTIFICACION_CLOSED_LOOP
+STATIC void IDENTIFICACION_Acquire(void *not_used) {
+    STATIC osal_tick_t last_wake;
+    static bool_t started = FALSE;
 
-        // Mapear el valor del PRBS a +1 o -1
-        u[i] = (lfsr & 1) ? 1 : 0;
+    if (!started) {
+        INTERFACE_Init();
+        OSAL_TASK_Delay(2000);
+        last_wake = OSAL_TASK_GetTickCount();
+        started = TRUE;
     }
-}
 
-static void acquire_output_signal(float *u, float *y, int size) {
-    STATIC osal_tick_t last_wake;
-    last_wake = OSAL_TASK_GetTickCount();
-    
-    for (int i = 0; i < size; i++) {
-        INTERFACE_DACWriteMv(u[i]*1000);
-        y[i] = (float)(INTERFACE_ADCRead(1)) / 1000.0;
-        OSAL_TASK_DelayUntil(&last_wake,OSAL_MS_TO_TICKS(5));
+    #ifndef TEST
+    while (TRUE)
+    #endif
+    {
+        float u_k = EXCITATION_Next(&excitation);
+        int16_t u_mv = (int16_t)(u_k * 1000);
+        INTERFACE_DACWriteMv(u_mv);
+        store_sample(u_mv, INTERFACE_ADCRead(1));
 
+        OSAL_TASK_DelayUntil(&last_wake, OSAL_MS_TO_TICKS(TS_MS));
     }
 }
 
-// Función para invertir una matriz 5x5 (Gauss-Jordan)
-void InvertMatrix(float A[5][5], float A_inv[5][5]) {
-    int i, j, k;
-    float ratio, a;
+#endif
 
-    // Inicializar A_inv como matriz identidad
-    for (i = 0; i < 5; i++) {
-        for (j = 0; j < 5; j++) {
-            A_inv[i][j] = (i == j) ? 1.0 : 0.0;
-        }
-    }
+STATIC void IDENTIFICACION_Estimate(void *not_used) {
+    static uint32_t expected_sequence = 0;
 
-    // Aplicar Gauss-Jordan
-    for (i = 0; i < 5; i++) {
-        a = A[i][i];
-        for (j = 0; j < 5; j++) {
-            A[i][j] = q15_div(A[i][j], a);
-            A_inv[i][j] = q15_div(A_inv[i][j], a);
-        }
-        for (k = 0; k < 5; k++) {
-            if (k != i) {
-                ratio = A[k][i];
-                for (j = 0; j < 5; j++) {
-                    A[k][j] -= MUL_ELEMENTS(ratio, A[i][j]);
-                    A_inv[k][j] -= MUL_ELEMENTS(ratio, A_inv[i][j]);
-                }
+    #ifndef TEST
+    while (TRUE)
+    #endif
+    {
+        const block_t *block;
+        if (OSAL_QUEUE_Acquire(&block_queue, (const void **)&block, OSAL_MAX_DELAY)) {
+            if (block->sequence != expected_sequence) {
+                ARX_Reset(&arx);    // The regressor holds samples from before the gap
+            }
+            expected_sequence = block->sequence + 1;
+
+            #if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH) && (BATCH_WINDOW > 0)
+            // The newest block replaces the oldest one and the window is summed again
+            LEAST_SQUARES_Reset(&window[window_index]);
+            estimate_block(&window[window_index], block);
+            window_index = (window_index + 1) % BATCH_WINDOW;
+            LEAST_SQUARES_Reset(&estimator);
+            for (uint8_t i = 0; i < BATCH_WINDOW; i++) {
+                LEAST_SQUARES_Merge(&estimator, &window[i]);
+            }
+            #else
+            estimate_block(&estimator, block);  // The sums keep growing, the fit length does not depend on MAX_SAMPLES
+            #endif
+            OSAL_QUEUE_Release(&block_queue, block);
+
+            #if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH)
+            float theta[NUM_PARAMS];
+            if (LEAST_SQUARES_Solve(&estimator, theta)) {
+                print_parameters(theta);
+                #if IDENTIFICACION_AUTOTUNE
+                autotune(theta);
+                #endif
+            }
+            else {
+                uartWriteString(UART_USB, "Identification failed: the excitation is not rich enough\n");
             }
+            #elif (IDENTIFICACION_MODE == IDENTIFICACION_RLS)
+            print_parameters(estimator.theta);
+            #if IDENTIFICACION_AUTOTUNE
+            autotune(estimator.theta);
+            #endif
+            #endif
         }
     }
 }
 
-// Función para resolver el sistema de ecuaciones utilizando cuadrados mínimos
-void LeastSquares(float *u, float *y, int size, float *a, float *b) {
-    static float Phi[DATA_SIZE][5] = {
-        [0 ... DATA_SIZE -1 ] = {
-            [0 ... 4] = 0
-        }
-    }; // Matriz de diseño
-    static float Y[DATA_SIZE] = {[0 ... DATA_SIZE -1 ] = 0};    // Vector de salida
-    static float PhiTPhi[5][5];       // PhiT * Phi
-    static float XtY[5];          // PhiT * Y
-    static float invPhiTPhi[5][5];    // Inversa de PhiTPhi
-    static float invPhiTPhiPhiT[5][DATA_SIZE] = {
-        [0 ... 4] = {
-            [0 ... DATA_SIZE -1 ] = 0
+static void store_sample(int16_t u_mv, int16_t y_mv) {
+    if (fill_block == NULL) {
+        OSAL_QUEUE_Loan(&block_queue, (void **)&fill_block, 0);     // The estimation has not started, every block is free
+    }
+    fill_block->u[fill_samples] = u_mv;
+    fill_block->y[fill_samples] = y_mv;
+    fill_samples++;
+
+    if (fill_samples == MAX_SAMPLES) {
+        block_t *next;
+        fill_block->sequence = fill_sequence++;
+        // Without a free block the estimation is late: keep sampling and refill this one
+        if (OSAL_QUEUE_Loan(&block_queue, (void **)&next, 0)) {
+            OSAL_QUEUE_Commit(&block_queue, fill_block);
+            fill_block = next;
         }
-    };
-
-    // Llenar la matriz de diseño y el vector de salida
-    for (int i = 2; i < (size); i++) {
-        Phi[i-2][0] = y[i - 1];
-        Phi[i-2][1] = y[i - 2];
-        Phi[i-2][2] = u[i];
-        Phi[i-2][3] = u[i-1];
-        Phi[i-2][4] = u[i-2];
-        Y[i - 2] = y[i];
-    }
-
-    // Calcular PhiTPhi
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < 5; j++) {
-            PhiTPhi[i][j] = 0;
-            for (int k = 0; k < size; k++) {
-                PhiTPhi[i][j] += MUL_ELEMENTS(Phi[k][i], Phi[k][j]);
-            }
+        else {
+            blocks_dropped++;
         }
+        fill_samples = 0;
     }
+}
 
-    InvertMatrix(PhiTPhi, invPhiTPhi);
+#if IDENTIFICACION_CLOSED_LOOP
+static int32_t sample_controller(int32_t u_mv, int32_t y_mv) {
+    store_sample((int16_t)u_mv, (int16_t)y_mv);
 
-    // Calcular invPhiTPhiPhiT
-    for (int i = 0; i < 5; i++) {
-        for (int j = 0; j < size; j++) {
-            invPhiTPhiPhiT[i][j] = 0;
-            for (int k = 0; k < 5; k++) {
-                invPhiTPhiPhiT[i][j] += MUL_ELEMENTS(invPhiTPhi[i][k], Phi[j][k]);
-            }
-        }
-    }
+    return (int32_t)(EXCITATION_Next(&excitation) * 1000);
+}
 
-    // Calcular XtY
-    for (int i = 0; i < 5; i++) {
-        XtY[i] = 0;
-        for (int j = 0; j < size; j++) {
-            XtY[i] += MUL_ELEMENTS(invPhiTPhiPhiT[i][j], Y[j]);
-        }
+#endif
+
+static void get_polynomials(const float *theta, float *den, float *num, float *noise) {
+    num[0] = 0;     // Left out of the fit in closed loop
+    ARX_GetPolynomials(&arx, theta, den, &num[NUM_DELAY - DEAD_TIME], noise);
+}
+
+static void print_parameters(const float *theta) {
+    static char str[150];
+    float den[ORDER + 1];
+    float num[ORDER + 1];
+    float noise[NOISE_ORDER + 1];
+    get_polynomials(theta, den, num, noise);
+
+    sprintf(str, "Identified system parameters:\n");
+    uartWriteString(UART_USB, str);
+    for (int i = 0; i <= ORDER; i++) {
+        sprintf(str, "DEN%d = %f\n", i, den[i]);
+        uartWriteString(UART_USB, str);
+    }
+    for (int i = 0; i <= ORDER; i++) {
+        sprintf(str, "NUM%d = %f\n", i, num[i]);
+        uartWriteString(UART_USB, str);
     }
+    for (int i = 1; i <= NOISE_ORDER; i++) {
+        sprintf(str, "NOISE%d = %f\n", i, noise[i]);
+        uartWriteString(UART_USB, str);
+    }
+    sprintf(str, "DELAY = %d\n", DEAD_TIME);
+    uartWriteString(UART_USB, str);
+    if (blocks_dropped > 0) {
+        sprintf(str, "DROPPED = %lu\n", (unsigned long)blocks_dropped);
+        uartWriteString(UART_USB, str);
+    }
+}
 
+#if IDENTIFICACION_AUTOTUNE
+static void autotune(const float *theta) {
+    static const autotune_poles_t poles = AUTOTUNE_POLES_DEFAULT;
+    float den[ORDER + 1];
+    float num[ORDER + 1];
+    float noise[NOISE_ORDER + 1];
+    get_polynomials(theta, den, num, noise);
 
-    a[0] = 1;
-    a[1] = -XtY[0];
-    a[2] = -XtY[1];
-    b[0] = XtY[3];
-    b[1] = XtY[4];
+    if (!converged(theta)) {
+        uartWriteString(UART_USB, "Retuning waits for the fit to converge\n");
+    }
+    else if (AUTOTUNE_Apply(den, num, &poles)) {
+        uartWriteString(UART_USB, "Controllers retuned\n");
+    }
+    else {
+        uartWriteString(UART_USB, "Retuning failed: the model cannot be controlled with the requested poles\n");
+    }
 }
 
-/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
+static bool_t converged(const float *theta) {
+    static float previous[NUM_PARAMS];
+    static uint32_t blocks = 0;
+    float change = 0;
+    float norm = 0;
+
+    for (uint8_t i = 0; i < NUM_PARAMS; i++) {
+        float delta = theta[i] - previous[i];
+        change += delta * delta;
+        norm += theta[i] * theta[i];
+        previous[i] = theta[i];
+    }
+    blocks++;
 
+    bool_t ret = (blocks >= AUTOTUNE_MIN_BLOCKS) && (change < AUTOTUNE_MAX_CHANGE * AUTOTUNE_MAX_CHANGE * norm);
+    #if (IDENTIFICACION_MODE == IDENTIFICACION_RLS)
+    float trace = 0;
+    for (uint8_t i = 0; i < NUM_PARAMS; i++) {
+        trace += estimator.P[i][i];
+    }
+    ret = ret && (trace < AUTOTUNE_MAX_TRACE);
+    #endif
+
+    return ret;
+}
 
+#endif
+
+static void estimate_block(estimator_t *estimator, const block_t *block) {
+    for (uint16_t i = 0; i < MAX_SAMPLES; i++) {
+        float u_k = (float)block->u[i] / 1000.0f;
+        float y_k = (float)block->y[i] / 1000.0f;
+
+        const float *phi = ARX_Regressor(&arx, u_k);
+        float e_k = 0;
+        if (ARX_Ready(&arx)) {
+            #if (IDENTIFICACION_MODE == IDENTIFICACION_BATCH)
+            LEAST_SQUARES_Add(estimator, phi, y_k);
+            #elif (IDENTIFICACION_MODE == IDENTIFICACION_RLS)
+            RLS_Update(estimator, phi, y_k);
+            e_k = ARX_Residual(&arx, estimator->theta, y_k);    // A posteriori, for the noise model
+            #endif
+        }
+        ARX_Advance(&arx, y_k, e_k);
+    }
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,115 @@
+/**
+ * @file least_squares.c
+ * @author Marcos Dominguez
+ *
+ * @brief Batch least squares through normal equations accumulated one sample at a time.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "least_squares.h"
+#include "linalg.h"
+#include <string.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MUL_ELEMENTS(a, b) ((a)*(b))
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t LEAST_SQUARES_Init(least_squares_t *ls, uint8_t num_params) {
+    bool_t ret = FALSE;
+    if (ls != NULL) {
+        if ((num_params > 0) && (num_params <= LEAST_SQUARES_MAX_PARAMS)) {
+            ls->num_params = num_params;
+            LEAST_SQUARES_Reset(ls);
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+void LEAST_SQUARES_Reset(least_squares_t *ls) {
+    memset(ls->PhiTPhi, 0, sizeof(ls->PhiTPhi));
+    memset(ls->PhiTY, 0, sizeof(ls->PhiTY));
+    ls->YTY = 0;
+    ls->count = 0;
+}
+
+void LEAST_SQUARES_Add(least_squares_t *ls, const float *phi, float y) {
+    uint8_t n = ls->num_params;
+    for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = i; j < n; j++) {
+            ls->PhiTPhi[i][j] += MUL_ELEMENTS((double)phi[i], (double)phi[j]);
+        }
+        ls->PhiTY[i] += MUL_ELEMENTS((double)phi[i], (double)y);
+    }
+    ls->YTY += MUL_ELEMENTS((double)y, (double)y);
+    ls->count++;
+}
+
+void LEAST_SQUARES_Merge(least_squares_t *ls, const least_squares_t *other) {
+    uint8_t n = ls->num_params;
+    for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = i; j < n; j++) {
+            ls->PhiTPhi[i][j] += other->PhiTPhi[i][j];
+        }
+        ls->PhiTY[i] += other->PhiTY[i];
+    }
+    ls->YTY += other->YTY;
+    ls->count += other->count;
+}
+
+bool_t LEAST_SQUARES_Solve(const least_squares_t *ls, float *theta) {
+    uint8_t n = ls->num_params;
+    float PhiTPhi[LEAST_SQUARES_MAX_PARAMS * LEAST_SQUARES_MAX_PARAMS];    // PhiT * Phi, lower triangle
+
+    for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = 0; j <= i; j++) {
+            LINALG_AT(PhiTPhi, n, i, j) = (float)ls->PhiTPhi[j][i];
+        }
+        theta[i] = (float)ls->PhiTY[i];
+    }
+
+    // theta = inv(PhiT * Phi) * PhiT * Y solved by L D L' without forming the inverse
+    bool_t ret = LINALG_LdltDecompose(PhiTPhi, n);
+    if (ret) {
+        LINALG_LdltSolve(PhiTPhi, n, theta);
+    }
+
+    return ret;
+}
+
+double LEAST_SQUARES_Loss(const least_squares_t *ls, const float *theta) {
+    uint8_t n = ls->num_params;
+    double loss = ls->YTY;
+    for (uint8_t i = 0; i < n; i++) {
+        double row = 0;     // (PhiT Phi theta)[i] from the upper triangle
+        for (uint8_t j = 0; j < n; j++) {
+            row += MUL_ELEMENTS((i <= j) ? ls->PhiTPhi[i][j] : ls->PhiTPhi[j][i], (double)theta[j]);
+        }
+        loss += MUL_ELEMENTS((double)theta[i], row - 2.0 * ls->PhiTY[i]);
+    }
+
+    return loss;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,191 @@
+/**
+ * @file linalg.c
+ * @author Marcos Dominguez
+ *
+ * @brief Small dense linear algebra in single precision.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "linalg.h"
+#include <math.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MUL_ELEMENTS(a, b) ((a)*(b))
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t LINALG_CholeskyDecompose(float *A, uint8_t n) {
+    bool_t ret = TRUE;
+    for (uint8_t j = 0; (j < n) && ret; j++) {
+        float diagonal = LINALG_AT(A, n, j, j);
+        for (uint8_t k = 0; k < j; k++) {
+            diagonal -= MUL_ELEMENTS(LINALG_AT(A, n, j, k), LINALG_AT(A, n, j, k));
+        }
+        if (diagonal > 0.0f) {
+            float l_jj = sqrtf(diagonal);
+            float inv_l_jj = 1.0f / l_jj;
+            LINALG_AT(A, n, j, j) = l_jj;
+            for (uint8_t i = j + 1; i < n; i++) {
+                float value = LINALG_AT(A, n, i, j);
+                for (uint8_t k = 0; k < j; k++) {
+                    value -= MUL_ELEMENTS(LINALG_AT(A, n, i, k), LINALG_AT(A, n, j, k));
+                }
+                LINALG_AT(A, n, i, j) = MUL_ELEMENTS(value, inv_l_jj);
+            }
+        }
+        else {
+            ret = FALSE;
+        }
+    }
+
+    return ret;
+}
+
+void LINALG_CholeskySolve(const float *L, uint8_t n, float *b) {
+    // L z = b
+    for (uint8_t i = 0; i < n; i++) {
+        float value = b[i];
+        for (uint8_t k = 0; k < i; k++) {
+            value -= MUL_ELEMENTS(LINALG_AT(L, n, i, k), b[k]);
+        }
+        b[i] = value / LINALG_AT(L, n, i, i);
+    }
+    // L' x = z
+    for (int16_t i = n - 1; i >= 0; i--) {
+        float value = b[i];
+        for (uint8_t k = i + 1; k < n; k++) {
+            value -= MUL_ELEMENTS(LINALG_AT(L, n, k, i), b[k]);
+        }
+        b[i] = value / LINALG_AT(L, n, i, i);
+    }
+}
+
+bool_t LINALG_LdltDecompose(float *A, uint8_t n) {
+    bool_t ret = TRUE;
+    for (uint8_t j = 0; (j < n) && ret; j++) {
+        float d_j = LINALG_AT(A, n, j, j);
+        for (uint8_t k = 0; k < j; k++) {
+            d_j -= MUL_ELEMENTS(MUL_ELEMENTS(LINALG_AT(A, n, j, k), LINALG_AT(A, n, j, k)), LINALG_AT(A, n, k, k));
+        }
+        if (d_j > 0.0f) {
+            float inv_d_j = 1.0f / d_j;
+            LINALG_AT(A, n, j, j) = d_j;
+            for (uint8_t i = j + 1; i < n; i++) {
+                float value = LINALG_AT(A, n, i, j);
+                for (uint8_t k = 0; k < j; k++) {
+                    value -= MUL_ELEMENTS(MUL_ELEMENTS(LINALG_AT(A, n, i, k), LINALG_AT(A, n, j, k)), LINALG_AT(A, n, k, k));
+                }
+                LINALG_AT(A, n, i, j) = MUL_ELEMENTS(value, inv_d_j);
+            }
+        }
+        else {
+            ret = FALSE;
+        }
+    }
+
+    return ret;
+}
+
+void LINALG_LdltSolve(const float *LD, uint8_t n, float *b) {
+    // L z = b
+    for (uint8_t i = 0; i < n; i++) {
+        float value = b[i];
+        for (uint8_t k = 0; k < i; k++) {
+            value -= MUL_ELEMENTS(LINALG_AT(LD, n, i, k), b[k]);
+        }
+        b[i] = value;
+    }
+    // D w = z
+    for (uint8_t i = 0; i < n; i++) {
+        b[i] /= LINALG_AT(LD, n, i, i);
+    }
+    // L' x = w
+    for (int16_t i = n - 1; i >= 0; i--) {
+        float value = b[i];
+        for (uint8_t k = i + 1; k < n; k++) {
+            value -= MUL_ELEMENTS(LINALG_AT(LD, n, k, i), b[k]);
+        }
+        b[i] = value;
+    }
+}
+
+bool_t LINALG_QrLeastSquares(float *A, uint16_t rows, uint8_t cols, float *b, float *x) {
+    bool_t ret = FALSE;
+    if ((cols > 0) && (cols <= LINALG_MAX_COLS) && (rows >= cols)) {
+        float r_diagonal[LINALG_MAX_COLS];
+        ret = TRUE;
+        for (uint8_t j = 0; (j < cols) && ret; j++) {
+            // Householder vector v of column j below the diagonal, stored in place
+            float norm = 0.0f;
+            for (uint16_t i = j; i < rows; i++) {
+                norm += MUL_ELEMENTS(LINALG_AT(A, cols, i, j), LINALG_AT(A, cols, i, j));
+            }
+            norm = sqrtf(norm);
+            if (norm > 0.0f) {
+                float alpha = (LINALG_AT(A, cols, j, j) > 0.0f) ? -norm : norm;
+                LINALG_AT(A, cols, j, j) -= alpha;
+                float v_norm2 = 0.0f;
+                for (uint16_t i = j; i < rows; i++) {
+                    v_norm2 += MUL_ELEMENTS(LINALG_AT(A, cols, i, j), LINALG_AT(A, cols, i, j));
+                }
+                float scale = 2.0f / v_norm2;
+
+                // Reflect the remaining columns and b
+                for (uint8_t k = j + 1; k < cols; k++) {
+                    float dot = 0.0f;
+                    for (uint16_t i = j; i < rows; i++) {
+                        dot += MUL_ELEMENTS(LINALG_AT(A, cols, i, j), LINALG_AT(A, cols, i, k));
+                    }
+                    dot *= scale;
+                    for (uint16_t i = j; i < rows; i++) {
+                        LINALG_AT(A, cols, i, k) -= MUL_ELEMENTS(dot, LINALG_AT(A, cols, i, j));
+                    }
+                }
+                float dot = 0.0f;
+                for (uint16_t i = j; i < rows; i++) {
+                    dot += MUL_ELEMENTS(LINALG_AT(A, cols, i, j), b[i]);
+                }
+                dot *= scale;
+                for (uint16_t i = j; i < rows; i++) {
+                    b[i] -= MUL_ELEMENTS(dot, LINALG_AT(A, cols, i, j));
+                }
+                r_diagonal[j] = alpha;
+            }
+            else {
+                ret = FALSE;
+            }
+        }
+
+        // R x = Q' b
+        for (int16_t i = cols - 1; (i >= 0) && ret; i--) {
+            float value = b[i];
+            for (uint8_t k = i + 1; k < cols; k++) {
+                value -= MUL_ELEMENTS(LINALG_AT(A, cols, i, k), x[k]);
+            }
+            x[i] = value / r_diagonal[i];
+        }
+    }
+
+    return ret;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
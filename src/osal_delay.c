@@ -14,8 +14,6 @@
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
-#define TICK_TYPE_MAX   ((1ULL << (sizeof(osal_tick_t) * 8)) - 1)
-
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
 /*========= [TASK DECLARATIONS] ================================================*/
@@ -39,7 +37,12 @@ void OSAL_DELAY_Reset(osal_delay_t *delay) {
 }
 
 void OSAL_DELAY_Config(osal_delay_t *delay, osal_tick_t time) {
-    delay->time = time;
+    OSAL_DELAY_ConfigUs(delay, (osal_time_t)time * OSAL_TICK_PERIOD_US);
+}
+
+void OSAL_DELAY_ConfigUs(osal_delay_t *delay, osal_time_t time_us) {
+    OSAL_TIME_Init();
+    delay->time = time_us;
     delay->running = FALSE;
 }
 
@@ -47,14 +50,10 @@ bool_t OSAL_DELAY_Check(osal_delay_t *delay) {
     bool_t ready = FALSE;
     if (!delay->running) { // init the delay if wasn't asked before.
         delay->running = TRUE;
-        delay->initial_time = OSAL_TASK_GetTickCount();
+        delay->initial_time = OSAL_TIME_GetUs();
     }
     else {
-        osal_tick_t time_count = OSAL_TASK_GetTickCount() - delay->initial_time;
-        if (time_count < 0) {
-            time_count = OSAL_TASK_GetTickCount() + (TICK_TYPE_MAX) -delay->initial_time;
-        }
-        if ((time_count) >= delay->time) {
+        if ((OSAL_TIME_GetUs() - delay->initial_time) >= delay->time) {
             ready = TRUE;
             delay->running = FALSE;
         }
@@ -0,0 +1,87 @@
+/**
+ * @file osal_notify.c
+ * @author Marcos Dominguez
+ *
+ * @brief Direct to task notifications.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_notify.h"
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_NOTIFY_Give(osal_task_t *task_ptr) {
+    bool_t ret = FALSE;
+    if (task_ptr != NULL) {
+        if (task_ptr->task_handler != NULL) {
+            PORT_TASK_NotifyGive(task_ptr->task_handler);
+            ret = TRUE;
+        }
+    }
+    return ret;
+}
+
+bool_t OSAL_NOTIFY_GiveFromISR(osal_task_t *task_ptr, bool_t *yield_need) {
+    bool_t ret = FALSE;
+    *yield_need = FALSE;
+    if (task_ptr != NULL) {
+        if (task_ptr->task_handler != NULL) {
+            PORT_TASK_NotifyGiveFromISR(task_ptr->task_handler, yield_need);
+            ret = TRUE;
+        }
+    }
+    return ret;
+}
+
+uint32_t OSAL_NOTIFY_Take(bool_t clear, osal_tick_t wait_time) {
+    return PORT_TASK_NotifyTake(clear, wait_time);
+}
+
+bool_t OSAL_NOTIFY_SetBits(osal_task_t *task_ptr, uint32_t bits) {
+    bool_t ret = FALSE;
+    if (task_ptr != NULL) {
+        if (task_ptr->task_handler != NULL) {
+            PORT_TASK_NotifySetBits(task_ptr->task_handler, bits);
+            ret = TRUE;
+        }
+    }
+    return ret;
+}
+
+bool_t OSAL_NOTIFY_SetBitsFromISR(osal_task_t *task_ptr, uint32_t bits, bool_t *yield_need) {
+    bool_t ret = FALSE;
+    *yield_need = FALSE;
+    if (task_ptr != NULL) {
+        if (task_ptr->task_handler != NULL) {
+            PORT_TASK_NotifySetBitsFromISR(task_ptr->task_handler, bits, yield_need);
+            ret = TRUE;
+        }
+    }
+    return ret;
+}
+
+bool_t OSAL_NOTIFY_WaitBits(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *bits, osal_tick_t wait_time) {
+    return PORT_TASK_NotifyWait(clear_on_entry, clear_on_exit, bits, wait_time);
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
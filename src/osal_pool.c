@@ -0,0 +1,210 @@
+/**
+ * @file osal_pool.c
+ * @author Marcos Dominguez
+ *
+ * @brief Fixed size block pool.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_pool.h"
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Unlink the first free block. Call inside the critical section.
+ */
+static void *Take(osal_pool_t *pool_ptr, void *caller, osal_tick_t tick);
+
+/**
+ * @brief Link a block back. Call inside the critical section.
+ */
+static bool_t Give(osal_pool_t *pool_ptr, void *block);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_POOL_LoadStruct(osal_pool_t *pool_ptr, osal_pool_storage_t *storage, uint32_t data_size, uint16_t block_count) {
+    bool_t ret = FALSE;
+    if ((pool_ptr != NULL) && (storage != NULL) && (data_size > 0) && (block_count > 0)) {
+        pool_ptr->storage = (uint8_t *)storage;
+        pool_ptr->block_size = OSAL_POOL_BlockWords(data_size) * sizeof(osal_pool_storage_t);
+        pool_ptr->block_count = block_count;
+        pool_ptr->used = 0;
+        pool_ptr->high_water = 0;
+        pool_ptr->failures = 0;
+        pool_ptr->trace = NULL;
+        // Link the blocks in address order, the first word of each points to the next
+        pool_ptr->free_list = NULL;
+        for (uint16_t i = block_count; i > 0; i--) {
+            void **block = (void **)&pool_ptr->storage[(uint32_t)(i - 1) * pool_ptr->block_size];
+            *block = pool_ptr->free_list;
+            pool_ptr->free_list = block;
+        }
+        ret = TRUE;
+    }
+
+    return ret;
+}
+
+bool_t OSAL_POOL_SetTrace(osal_pool_t *pool_ptr, osal_pool_trace_t *trace) {
+    bool_t ret = FALSE;
+    if (pool_ptr != NULL) {
+        if (trace != NULL) {
+            for (uint16_t i = 0; i < pool_ptr->block_count; i++) {
+                trace[i].caller = NULL;
+                trace[i].tick = 0;
+            }
+        }
+        // A block taken before would read as free and its Free would be rejected
+        OSAL_TASK_EnterCritical();
+        if (pool_ptr->used == 0) {
+            pool_ptr->trace = trace;
+            ret = TRUE;
+        }
+        OSAL_TASK_ExitCritical();
+    }
+
+    return ret;
+}
+
+void *OSAL_POOL_Alloc(osal_pool_t *pool_ptr) {
+    void *block = NULL;
+    if (pool_ptr != NULL) {
+        void *caller = __builtin_return_address(0);
+        osal_tick_t tick = OSAL_TASK_GetTickCount();
+        OSAL_TASK_EnterCritical();
+        block = Take(pool_ptr, caller, tick);
+        OSAL_TASK_ExitCritical();
+    }
+
+    return block;
+}
+
+bool_t OSAL_POOL_Free(osal_pool_t *pool_ptr, void *block) {
+    bool_t ret = FALSE;
+    if ((pool_ptr != NULL) && (block != NULL)) {
+        OSAL_TASK_EnterCritical();
+        ret = Give(pool_ptr, block);
+        OSAL_TASK_ExitCritical();
+    }
+
+    return ret;
+}
+
+void *OSAL_POOL_AllocFromISR(osal_pool_t *pool_ptr) {
+    void *block = NULL;
+    if (pool_ptr != NULL) {
+        void *caller = __builtin_return_address(0);
+        osal_tick_t tick = OSAL_TASK_GetTickCountFromISR();
+        UBaseType_t saved_mask = OSAL_TASK_EnterCriticalFromISR();
+        block = Take(pool_ptr, caller, tick);
+        OSAL_TASK_ExitCriticalFromISR(saved_mask);
+    }
+
+    return block;
+}
+
+bool_t OSAL_POOL_FreeFromISR(osal_pool_t *pool_ptr, void *block) {
+    bool_t ret = FALSE;
+    if ((pool_ptr != NULL) && (block != NULL)) {
+        UBaseType_t saved_mask = OSAL_TASK_EnterCriticalFromISR();
+        ret = Give(pool_ptr, block);
+        OSAL_TASK_ExitCriticalFromISR(saved_mask);
+    }
+
+    return ret;
+}
+
+uint16_t OSAL_POOL_Used(const osal_pool_t *pool_ptr) {
+    return (pool_ptr != NULL) ? pool_ptr->used : 0;
+}
+
+uint16_t OSAL_POOL_HighWater(const osal_pool_t *pool_ptr) {
+    return (pool_ptr != NULL) ? pool_ptr->high_water : 0;
+}
+
+void OSAL_POOL_ResetHighWater(osal_pool_t *pool_ptr) {
+    if (pool_ptr != NULL) {
+        OSAL_TASK_EnterCritical();
+        pool_ptr->high_water = pool_ptr->used;
+        pool_ptr->failures = 0;
+        OSAL_TASK_ExitCritical();
+    }
+}
+
+const osal_pool_trace_t *OSAL_POOL_GetTrace(const osal_pool_t *pool_ptr, uint16_t index) {
+    const osal_pool_trace_t *trace = NULL;
+    if (pool_ptr != NULL) {
+        if ((pool_ptr->trace != NULL) && (index < pool_ptr->block_count)) {
+            trace = &pool_ptr->trace[index];
+        }
+    }
+
+    return trace;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static void *Take(osal_pool_t *pool_ptr, void *caller, osal_tick_t tick) {
+    void **block = pool_ptr->free_list;
+    if (block != NULL) {
+        pool_ptr->free_list = *block;
+        pool_ptr->used++;
+        if (pool_ptr->used > pool_ptr->high_water) {
+            pool_ptr->high_water = pool_ptr->used;
+        }
+        if (pool_ptr->trace != NULL) {
+            uint32_t index = (uint32_t)((uint8_t *)block - pool_ptr->storage) / pool_ptr->block_size;
+            pool_ptr->trace[index].caller = caller;
+            pool_ptr->trace[index].tick = tick;
+        }
+    }
+    else {
+        pool_ptr->failures++;
+    }
+
+    return block;
+}
+
+static bool_t Give(osal_pool_t *pool_ptr, void *block) {
+    bool_t ret = FALSE;
+    uintptr_t offset = (uintptr_t)block - (uintptr_t)pool_ptr->storage;
+    // Below the storage the offset wraps and fails the range check too
+    // With every block free it is a double free, with or without trace
+    if ((pool_ptr->used > 0) && (offset < ((uintptr_t)pool_ptr->block_size * pool_ptr->block_count)) && ((offset % pool_ptr->block_size) == 0)) {
+        uint32_t index = (uint32_t)(offset / pool_ptr->block_size);
+        ret = TRUE;
+        if (pool_ptr->trace != NULL) {
+            if (pool_ptr->trace[index].caller == NULL) {
+                ret = FALSE;    // Double free
+            }
+            else {
+                pool_ptr->trace[index].caller = NULL;
+            }
+        }
+        if (ret) {
+            *(void **)block = pool_ptr->free_list;
+            pool_ptr->free_list = block;
+            pool_ptr->used--;
+        }
+    }
+
+    return ret;
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
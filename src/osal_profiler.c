@@ -0,0 +1,202 @@
+/**
+ * @file osal_profiler.c
+ * @author Marcos Dominguez
+ *
+ * @brief Timing instrumentation of periodic loops.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_profiler.h"
+#include <string.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define CYCLES_MAX  ((osal_cycles_t)0xFFFFFFFFUL)
+
+#define GET_ATTEMPTS    4   /**< Copies tried by OSAL_PROFILER_Get before it gives up. */
+
+/* Keep the statistics updates ordered against the sequence counter */
+#define COMPILER_BARRIER()  __asm__ volatile ("" ::: "memory")
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Clear a statistic.
+ */
+static void StatReset(osal_profiler_stat_t *stat);
+
+/**
+ * @brief Add a value to a statistic.
+ */
+static void StatAdd(osal_profiler_stat_t *stat, osal_cycles_t value, uint32_t cycles_per_us);
+
+/**
+ * @brief Clamp a duration to the range of the statistics.
+ */
+__STATIC_FORCEINLINE osal_cycles_t Duration(osal_time_t cycles);
+
+/**
+ * @brief Histogram bucket of a value in us.
+ */
+__STATIC_FORCEINLINE uint8_t Bucket(uint32_t us);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_PROFILER_Init(osal_profiler_t *profiler, uint32_t period_us, uint32_t deadline_us) {
+    bool_t ret = FALSE;
+    if (profiler != NULL) {
+        OSAL_TIME_Init();
+        profiler->cycles_per_us = OSAL_TIME_CyclesPerUs();
+        if (profiler->cycles_per_us == 0) {
+            profiler->cycles_per_us = 1;
+        }
+        profiler->period = period_us * profiler->cycles_per_us;
+        profiler->deadline = deadline_us * profiler->cycles_per_us;
+        profiler->sequence = 0;
+        OSAL_PROFILER_Reset(profiler);
+        ret = TRUE;
+    }
+
+    return ret;
+}
+
+void OSAL_PROFILER_Reset(osal_profiler_t *profiler) {
+    profiler->sequence++;
+    COMPILER_BARRIER();
+    profiler->started = FALSE;
+    profiler->next_release = 0;
+    profiler->begin = 0;
+    profiler->lateness = 0;
+    StatReset(&profiler->execution);
+    StatReset(&profiler->jitter);
+    StatReset(&profiler->response);
+    profiler->deadline_misses = 0;
+    COMPILER_BARRIER();
+    profiler->sequence++;
+}
+
+void OSAL_PROFILER_Begin(osal_profiler_t *profiler) {
+    osal_time_t now = OSAL_TIME_GetCycles();
+    profiler->sequence++;
+    COMPILER_BARRIER();
+    if (profiler->started) {
+        int64_t lateness = (int64_t)(now - profiler->next_release);
+        osal_cycles_t jitter = Duration((lateness < 0) ? (osal_time_t)(-lateness) : (osal_time_t)lateness);
+        StatAdd(&profiler->jitter, jitter, profiler->cycles_per_us);
+        if (jitter > profiler->period) {
+            /* Lost the phase (first call after a pause), take this one as the release */
+            profiler->next_release = now;
+            lateness = 0;
+        }
+        profiler->lateness = (lateness > 0) ? Duration((osal_time_t)lateness) : 0;
+        profiler->next_release += profiler->period;
+    }
+    else {
+        profiler->started = TRUE;
+        profiler->lateness = 0;
+        profiler->next_release = now + profiler->period;
+    }
+    profiler->begin = now;
+    COMPILER_BARRIER();
+    profiler->sequence++;
+}
+
+void OSAL_PROFILER_End(osal_profiler_t *profiler) {
+    osal_cycles_t execution = Duration(OSAL_TIME_GetCycles() - profiler->begin);
+    osal_cycles_t response = Duration((osal_time_t)profiler->lateness + execution);
+    profiler->sequence++;
+    COMPILER_BARRIER();
+    StatAdd(&profiler->execution, execution, profiler->cycles_per_us);
+    StatAdd(&profiler->response, response, profiler->cycles_per_us);
+    if (response > profiler->deadline) {
+        profiler->deadline_misses++;
+    }
+    COMPILER_BARRIER();
+    profiler->sequence++;
+}
+
+bool_t OSAL_PROFILER_Get(const osal_profiler_t *profiler, osal_profiler_t *snapshot) {
+    bool_t ret = FALSE;
+    if (profiler != NULL) {
+        if (snapshot != NULL) {
+            // A reader above the writer priority that preempted an update
+            // never sees it finish, so the copies are bounded
+            for (uint8_t attempt = 0; (attempt < GET_ATTEMPTS) && !ret; attempt++) {
+                uint32_t sequence = profiler->sequence;
+                COMPILER_BARRIER();
+                memcpy(snapshot, (const void *)profiler, sizeof(osal_profiler_t));
+                COMPILER_BARRIER();
+                ret = ((sequence & 1) || (sequence != profiler->sequence)) ? FALSE : TRUE;
+            }
+        }
+    }
+
+    return ret;
+}
+
+osal_cycles_t OSAL_PROFILER_Mean(const osal_profiler_stat_t *stat) {
+    osal_cycles_t mean = 0;
+    if (stat->count > 0) {
+        mean = (osal_cycles_t)(stat->sum / stat->count);
+    }
+
+    return mean;
+}
+
+uint32_t OSAL_PROFILER_CyclesToUs(const osal_profiler_t *profiler, osal_cycles_t cycles) {
+    return cycles / profiler->cycles_per_us;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static void StatReset(osal_profiler_stat_t *stat) {
+    stat->min = CYCLES_MAX;
+    stat->max = 0;
+    stat->sum = 0;
+    stat->count = 0;
+    memset(stat->histogram, 0, sizeof(stat->histogram));
+}
+
+static void StatAdd(osal_profiler_stat_t *stat, osal_cycles_t value, uint32_t cycles_per_us) {
+    if (value < stat->min) {
+        stat->min = value;
+    }
+    if (value > stat->max) {
+        stat->max = value;
+    }
+    stat->sum += value;
+    stat->count++;
+    stat->histogram[Bucket(value / cycles_per_us)]++;
+}
+
+__STATIC_FORCEINLINE osal_cycles_t Duration(osal_time_t cycles) {
+    return (cycles > CYCLES_MAX) ? CYCLES_MAX : (osal_cycles_t)cycles;
+}
+
+__STATIC_FORCEINLINE uint8_t Bucket(uint32_t us) {
+    uint8_t bucket = 0;
+    if (us > 0) {
+        bucket = (uint8_t)(32 - __builtin_clz(us));     /* CLZ instruction on the M4 */
+        if (bucket >= OSAL_PROFILER_BUCKETS) {
+            bucket = OSAL_PROFILER_BUCKETS - 1;
+        }
+    }
+
+    return bucket;
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
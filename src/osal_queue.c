@@ -98,6 +98,140 @@ bool_t OSAL_QUEUE_ReceiveFromISR(osal_queue_t *queue_ptr, void *const data, bool
     return ret;
 }
 
+uint16_t OSAL_QUEUE_SendN(osal_queue_t *queue_ptr, const void *data, uint16_t count, osal_tick_t wait_time) {
+    uint16_t ret = 0;
+    if ((queue_ptr != NULL) && (data != NULL)) {
+        if (queue_ptr->handler != NULL) {
+            if (count == 1) {   // Same path as OSAL_QUEUE_Send, without the batch setup
+                ret = PORT_QUEUE_Send(queue_ptr->handler, (void *)data, wait_time) ? 1 : 0;
+            }
+            else {
+                ret = PORT_QUEUE_SendN(queue_ptr->handler, data, queue_ptr->data_size, count, wait_time);
+            }
+        }
+    }
+    return ret;
+}
+
+uint16_t OSAL_QUEUE_ReceiveN(osal_queue_t *queue_ptr, void *data, uint16_t count, osal_tick_t wait_time) {
+    uint16_t ret = 0;
+    if ((queue_ptr != NULL) && (data != NULL)) {
+        if (queue_ptr->handler != NULL) {
+            if (count == 1) {   // Same path as OSAL_QUEUE_Receive, without the batch setup
+                ret = PORT_QUEUE_Receive(queue_ptr->handler, data, wait_time) ? 1 : 0;
+            }
+            else {
+                ret = PORT_QUEUE_ReceiveN(queue_ptr->handler, data, queue_ptr->data_size, count, wait_time);
+            }
+        }
+    }
+    return ret;
+}
+
+uint16_t OSAL_QUEUE_SendNFromISR(osal_queue_t *queue_ptr, const void *data, uint16_t count, bool_t *yield_need) {
+    uint16_t ret = 0;
+    *yield_need = FALSE;
+    if ((queue_ptr != NULL) && (data != NULL)) {
+        if (queue_ptr->handler != NULL)
+            ret = PORT_QUEUE_SendNFromISR(queue_ptr->handler, data, queue_ptr->data_size, count, yield_need);
+    }
+    return ret;
+}
+
+uint16_t OSAL_QUEUE_ReceiveNFromISR(osal_queue_t *queue_ptr, void *data, uint16_t count, bool_t *yield_need) {
+    uint16_t ret = 0;
+    *yield_need = FALSE;
+    if ((queue_ptr != NULL) && (data != NULL)) {
+        if (queue_ptr->handler != NULL)
+            ret = PORT_QUEUE_ReceiveNFromISR(queue_ptr->handler, data, queue_ptr->data_size, count, yield_need);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_LoanLoadStruct(osal_queue_loan_t *queue_ptr, osal_queue_holder_t *holder_ptr, uint8_t *index_storage, uint8_t *element_storage, uint32_t data_size, uint16_t queue_length) {
+    bool_t ret = FALSE;
+    if ((queue_ptr != NULL) && (holder_ptr != NULL) && (index_storage != NULL)) {
+        if ((element_storage != NULL) && (data_size > 0)) {
+            uint8_t *free_storage = &index_storage[OSAL_QUEUE_StackSize(sizeof(void *), queue_length)];
+            if (OSAL_QUEUE_LoadStruct(&queue_ptr->filled, &holder_ptr[0], index_storage, sizeof(void *), queue_length)
+                && OSAL_QUEUE_LoadStruct(&queue_ptr->free, &holder_ptr[1], free_storage, sizeof(void *), queue_length)) {
+                queue_ptr->element_storage = element_storage;
+                queue_ptr->data_size = data_size;
+                queue_ptr->queue_length = queue_length;
+                ret = TRUE;
+            }
+        }
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_LoanCreate(osal_queue_loan_t *queue_ptr) {
+    bool_t ret = FALSE;
+    if (queue_ptr != NULL) {
+        if (OSAL_QUEUE_Create(&queue_ptr->filled) && OSAL_QUEUE_Create(&queue_ptr->free)) {
+            ret = TRUE;
+            for (uint16_t i = 0; i < queue_ptr->queue_length; i++) {
+                void *element = &queue_ptr->element_storage[i * queue_ptr->data_size];
+                if (!OSAL_QUEUE_Send(&queue_ptr->free, &element, 0)) {
+                    ret = FALSE;
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_Loan(osal_queue_loan_t *queue_ptr, void **element, osal_tick_t wait_time) {
+    bool_t ret = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        ret = OSAL_QUEUE_Receive(&queue_ptr->free, element, wait_time);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_Commit(osal_queue_loan_t *queue_ptr, void *element) {
+    bool_t ret = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        // There are only queue_length elements, the queue of pointers always has room
+        ret = OSAL_QUEUE_Send(&queue_ptr->filled, &element, 0);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_Acquire(osal_queue_loan_t *queue_ptr, const void **element, osal_tick_t wait_time) {
+    bool_t ret = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        ret = OSAL_QUEUE_Receive(&queue_ptr->filled, (void *)element, wait_time);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_Release(osal_queue_loan_t *queue_ptr, const void *element) {
+    bool_t ret = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        ret = OSAL_QUEUE_Send(&queue_ptr->free, &element, 0);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_LoanFromISR(osal_queue_loan_t *queue_ptr, void **element, bool_t *yield_need) {
+    bool_t ret = FALSE;
+    *yield_need = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        ret = OSAL_QUEUE_ReceiveFromISR(&queue_ptr->free, element, yield_need);
+    }
+    return ret;
+}
+
+bool_t OSAL_QUEUE_CommitFromISR(osal_queue_loan_t *queue_ptr, void *element, bool_t *yield_need) {
+    bool_t ret = FALSE;
+    *yield_need = FALSE;
+    if ((queue_ptr != NULL) && (element != NULL)) {
+        ret = OSAL_QUEUE_SendFromISR(&queue_ptr->filled, &element, yield_need);
+    }
+    return ret;
+}
+
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,161 @@
+/**
+ * @file osal_spsc.c
+ * @author Marcos Dominguez
+ *
+ * @brief Lock free single producer single consumer ring buffer.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_spsc.h"
+#include <string.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+/*
+ * Release on the store and acquire on the load order the element copy
+ * against the index. On the M4 they compile to plain accesses and a DMB.
+ */
+#define LOAD_ACQUIRE(x)     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+
+/*
+ * The producer publishes the head and then reads the tail, the consumer
+ * publishes the tail and then reads the head. The full fence between the
+ * two accesses makes at least one of them see the other, so either the
+ * producer notifies or the consumer sees the element and does not sleep.
+ */
+#define FULL_FENCE()        __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Copy the element in and publish it.
+ *
+ * @return bool_t   TRUE if the consumer had caught up and must be notified.
+ */
+static bool_t Push(osal_spsc_t *spsc_ptr, const void *data, bool_t *pushed);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_SPSC_LoadStruct(osal_spsc_t *spsc_ptr, uint8_t *storage, uint32_t data_size, uint32_t capacity) {
+    bool_t ret = FALSE;
+    if ((spsc_ptr != NULL) && (storage != NULL)) {
+        if ((data_size > 0) && (capacity > 0) && ((capacity & (capacity - 1)) == 0)) {
+            spsc_ptr->storage = storage;
+            spsc_ptr->data_size = data_size;
+            spsc_ptr->mask = capacity - 1;
+            spsc_ptr->head = 0;
+            spsc_ptr->tail = 0;
+            spsc_ptr->consumer = NULL;
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+bool_t OSAL_SPSC_SetConsumer(osal_spsc_t *spsc_ptr, osal_task_t *task_ptr) {
+    bool_t ret = FALSE;
+    if (spsc_ptr != NULL) {
+        spsc_ptr->consumer = (task_ptr != NULL) ? task_ptr->task_handler : NULL;
+        ret = TRUE;
+    }
+
+    return ret;
+}
+
+bool_t OSAL_SPSC_Push(osal_spsc_t *spsc_ptr, const void *data) {
+    bool_t ret = FALSE;
+    if ((spsc_ptr != NULL) && (data != NULL) && (spsc_ptr->storage != NULL)) {
+        if (Push(spsc_ptr, data, &ret)) {
+            PORT_TASK_NotifyGive(spsc_ptr->consumer);
+        }
+    }
+
+    return ret;
+}
+
+bool_t OSAL_SPSC_PushFromISR(osal_spsc_t *spsc_ptr, const void *data, bool_t *yield_need) {
+    bool_t ret = FALSE;
+    *yield_need = FALSE;
+    if ((spsc_ptr != NULL) && (data != NULL) && (spsc_ptr->storage != NULL)) {
+        if (Push(spsc_ptr, data, &ret)) {
+            PORT_TASK_NotifyGiveFromISR(spsc_ptr->consumer, yield_need);
+        }
+    }
+
+    return ret;
+}
+
+bool_t OSAL_SPSC_Pop(osal_spsc_t *spsc_ptr, void *data) {
+    bool_t ret = FALSE;
+    if ((spsc_ptr != NULL) && (data != NULL) && (spsc_ptr->storage != NULL)) {
+        uint32_t tail = spsc_ptr->tail;
+        if (tail != LOAD_ACQUIRE(spsc_ptr->head)) {
+            memcpy(data, &spsc_ptr->storage[(tail & spsc_ptr->mask) * spsc_ptr->data_size], spsc_ptr->data_size);
+            STORE_RELEASE(spsc_ptr->tail, tail + 1);
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+bool_t OSAL_SPSC_Wait(osal_spsc_t *spsc_ptr, osal_tick_t wait_time) {
+    bool_t ret = FALSE;
+    if (spsc_ptr != NULL) {
+        FULL_FENCE();   // Pairs with the one of Push, the tail was published by the last pop
+        ret = (LOAD_ACQUIRE(spsc_ptr->head) != spsc_ptr->tail) ? TRUE : FALSE;
+        if (!ret && (spsc_ptr->consumer != NULL)) {
+            // A notification left from a push already popped only costs one more check
+            while (!ret && (PORT_TASK_NotifyTake(TRUE, wait_time) > 0)) {
+                ret = (LOAD_ACQUIRE(spsc_ptr->head) != spsc_ptr->tail) ? TRUE : FALSE;
+            }
+        }
+    }
+
+    return ret;
+}
+
+uint32_t OSAL_SPSC_Count(const osal_spsc_t *spsc_ptr) {
+    uint32_t ret = 0;
+    if (spsc_ptr != NULL) {
+        ret = LOAD_ACQUIRE(spsc_ptr->head) - LOAD_ACQUIRE(spsc_ptr->tail);
+    }
+
+    return ret;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static bool_t Push(osal_spsc_t *spsc_ptr, const void *data, bool_t *pushed) {
+    bool_t notify = FALSE;
+    uint32_t head = spsc_ptr->head;
+    if ((head - LOAD_ACQUIRE(spsc_ptr->tail)) <= spsc_ptr->mask) {
+        memcpy(&spsc_ptr->storage[(head & spsc_ptr->mask) * spsc_ptr->data_size], data, spsc_ptr->data_size);
+        STORE_RELEASE(spsc_ptr->head, head + 1);
+        *pushed = TRUE;
+        if (spsc_ptr->consumer != NULL) {
+            FULL_FENCE();
+            notify = (LOAD_ACQUIRE(spsc_ptr->tail) == head) ? TRUE : FALSE;
+        }
+    }
+
+    return notify;
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,51 @@
+/**
+ * @file osal_time.c
+ * @author Marcos Dominguez
+ *
+ * @brief 64 bit monotonic time base.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_time.h"
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_TIME_Init(void) {
+    PORT_TIME_Init();
+
+    return (PORT_TIME_CyclesPerUs() > 0) ? TRUE : FALSE;
+}
+
+osal_time_t OSAL_TIME_GetUs(void) {
+    return OSAL_TIME_CyclesToUs(PORT_TIME_GetCycles());
+}
+
+osal_time_t OSAL_TIME_CyclesToUs(osal_time_t cycles) {
+    return cycles / PORT_TIME_CyclesPerUs();
+}
+
+osal_time_t OSAL_TIME_UsToCycles(osal_time_t us) {
+    return us * PORT_TIME_CyclesPerUs();
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
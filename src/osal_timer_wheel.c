@@ -0,0 +1,241 @@
+/**
+ * @file osal_timer_wheel.c
+ * @author Marcos Dominguez
+ *
+ * @brief Software timers multiplexed on a single kernel timer by a hashed timing wheel.
+ *
+ * The slots are doubly linked lists, so a timer is unlinked without a search.
+ * The lists are only touched inside a critical section, short and of constant
+ * length except for the walk of one slot in a turn. The callbacks run
+ * outside of it.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_timer_wheel.h"
+#include "osal_task.h"
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define WHEEL_MASK          (TIMER_WHEEL_SLOTS - 1)
+
+#define WHEEL_TICK          OSAL_MS_TO_TICKS(TIMER_WHEEL_TICK_MS)   /**< Kernel ticks of a turn. */
+
+#if ((TIMER_WHEEL_SLOTS & WHEEL_MASK) != 0)
+#error "TIMER_WHEEL_SLOTS must be a power of 2"
+#endif
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/**
+ * @brief State of a wheel timer.
+ */
+typedef enum {
+    WHEEL_TIMER_STOPPED,
+    WHEEL_TIMER_LINKED,
+    WHEEL_TIMER_EXPIRED,
+} wheel_timer_state_t;
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Link a timer to the slot where it expires. Call inside the critical section.
+ */
+static void Link(osal_wheel_timer_t *timer);
+
+/**
+ * @brief Unlink a timer from its slot. Call inside the critical section.
+ */
+static void Unlink(osal_wheel_timer_t *timer);
+
+/**
+ * @brief Advance the wheel one slot and call back the timers that expire. Kernel timer callback.
+ */
+static void Turn(void *context);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static osal_wheel_timer_t *slots[TIMER_WHEEL_SLOTS] = {NULL};
+
+static uint32_t cursor = 0;     /**< Slot of the last turn. */
+
+static bool_t turning = FALSE;  /**< The kernel timer was started or is being started. */
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t OSAL_TIMER_WHEEL_Init(void) {
+    static osal_timer_t wheel_timer;
+    static osal_timer_holder_t wheel_holder;
+    bool_t ret = TRUE;
+
+    OSAL_TASK_EnterCritical();
+    bool_t start = !turning;
+    turning = TRUE;
+    OSAL_TASK_ExitCritical();
+
+    if (start) {
+        ret = FALSE;
+        if (OSAL_TIMERS_LoadStruct(&wheel_timer, "TIMER WHEEL", WHEEL_TICK, TRUE, Turn, NULL, &wheel_holder)) {
+            if (OSAL_TIMERS_Create(&wheel_timer)) {
+                ret = (OSAL_TIMERS_Start(&wheel_timer)) ? TRUE : FALSE;
+            }
+        }
+        turning = ret;  // A later call tries again
+    }
+    return ret;
+}
+
+bool_t OSAL_TIMER_WHEEL_LoadStruct(osal_wheel_timer_t *timer, osal_tick_t time, bool_t repeat, UtilsCallback_t Callback, void *context) {
+    bool_t ret = FALSE;
+    if ((timer != NULL) && (Callback != NULL)) {
+        timer->next = NULL;
+        timer->prev = NULL;
+        timer->expired = NULL;
+        timer->callback = Callback;
+        timer->context = context;
+        timer->time = time;
+        timer->rounds = 0;
+        timer->slot = 0;
+        timer->state = WHEEL_TIMER_STOPPED;
+        timer->repeat = repeat;
+        ret = TRUE;
+    }
+    return ret;
+}
+
+bool_t OSAL_TIMER_WHEEL_Start(osal_wheel_timer_t *timer) {
+    bool_t ret = FALSE;
+    if ((timer != NULL) && OSAL_TIMER_WHEEL_Init()) {
+        OSAL_TASK_EnterCritical();
+        if (timer->state == WHEEL_TIMER_LINKED) {
+            Unlink(timer);
+        }
+        Link(timer);
+        OSAL_TASK_ExitCritical();
+        ret = TRUE;
+    }
+    return ret;
+}
+
+bool_t OSAL_TIMER_WHEEL_Stop(osal_wheel_timer_t *timer) {
+    bool_t ret = FALSE;
+    if (timer != NULL) {
+        OSAL_TASK_EnterCritical();
+        if (timer->state == WHEEL_TIMER_LINKED) {
+            Unlink(timer);
+        }
+        timer->state = WHEEL_TIMER_STOPPED;
+        OSAL_TASK_ExitCritical();
+        ret = TRUE;
+    }
+    return ret;
+}
+
+bool_t OSAL_TIMER_WHEEL_ChangePeriod(osal_wheel_timer_t *timer, osal_tick_t time) {
+    bool_t ret = FALSE;
+    if ((timer != NULL) && OSAL_TIMER_WHEEL_Init()) {
+        OSAL_TASK_EnterCritical();
+        timer->time = time;
+        if (timer->state == WHEEL_TIMER_LINKED) {
+            Unlink(timer);
+        }
+        Link(timer);
+        OSAL_TASK_ExitCritical();
+        ret = TRUE;
+    }
+    return ret;
+}
+
+bool_t OSAL_TIMER_WHEEL_IsActive(osal_wheel_timer_t *timer) {
+    bool_t ret = FALSE;
+    if (timer != NULL) {
+        ret = (timer->state != WHEEL_TIMER_STOPPED) ? TRUE : FALSE;
+    }
+    return ret;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static void Link(osal_wheel_timer_t *timer) {
+    uint32_t turns = (timer->time + WHEEL_TICK - 1) / WHEEL_TICK;
+    if (turns == 0) {
+        turns = 1;
+    }
+    // The slot is reached every TIMER_WHEEL_SLOTS turns, the last visit expires it
+    timer->slot = (uint16_t)((cursor + turns) & WHEEL_MASK);
+    timer->rounds = (turns - 1) / TIMER_WHEEL_SLOTS;
+    timer->prev = NULL;
+    timer->next = slots[timer->slot];
+    if (timer->next != NULL) {
+        timer->next->prev = timer;
+    }
+    slots[timer->slot] = timer;
+    timer->state = WHEEL_TIMER_LINKED;
+}
+
+static void Unlink(osal_wheel_timer_t *timer) {
+    if (timer->prev != NULL) {
+        timer->prev->next = timer->next;
+    }
+    else {
+        slots[timer->slot] = timer->next;
+    }
+    if (timer->next != NULL) {
+        timer->next->prev = timer->prev;
+    }
+    timer->next = NULL;
+    timer->prev = NULL;
+}
+
+static void Turn(void *context) {
+    (void)context;
+    osal_wheel_timer_t *expired = NULL;
+
+    OSAL_TASK_EnterCritical();
+    cursor = (cursor + 1) & WHEEL_MASK;
+    osal_wheel_timer_t *timer = slots[cursor];
+    while (timer != NULL) {
+        osal_wheel_timer_t *next = timer->next;
+        if (timer->rounds == 0) {
+            Unlink(timer);
+            timer->state = WHEEL_TIMER_EXPIRED;
+            timer->expired = expired;
+            expired = timer;
+        }
+        else {
+            timer->rounds--;
+        }
+        timer = next;
+    }
+    OSAL_TASK_ExitCritical();
+
+    while (expired != NULL) {
+        timer = expired;
+        expired = timer->expired;
+        // A callback called before may have stopped or started this one
+        if (timer->state == WHEEL_TIMER_EXPIRED) {
+            timer->callback(timer->context);
+            OSAL_TASK_EnterCritical();
+            if (timer->state == WHEEL_TIMER_EXPIRED) {
+                if (timer->repeat) {
+                    Link(timer);
+                }
+                else {
+                    timer->state = WHEEL_TIMER_STOPPED;
+                }
+            }
+            OSAL_TASK_ExitCritical();
+        }
+    }
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
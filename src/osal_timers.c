@@ -42,10 +42,10 @@ bool_t OSAL_TIMERS_LoadStruct(osal_timer_t *timer, char *name, osal_tick_t time,
     return ret;
 }
 
-bool_t OSAL_TIMERS_Create(osal_timer_t *timer, timer_index_t index) {
+bool_t OSAL_TIMERS_Create(osal_timer_t *timer) {
     bool_t ret = FALSE;
     if ((timer != NULL) && timer->callback.callback != NULL) {
-        timer->handler = PORT_TIMER_Create(timer->name, timer->time, timer->repeat, &timer->callback, timer->holder_ptr, index);
+        timer->handler = PORT_TIMER_Create(timer->name, timer->time, timer->repeat, &timer->callback, timer->holder_ptr);
         if (timer->handler != NULL) {
             ret = TRUE;
         }
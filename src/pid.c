@@ -11,38 +11,17 @@
 /*========= [DEPENDENCIES] =====================================================*/
 
 #include "pid.h"
-#include <string.h>
-
+#include "control_config.h"
+#include "discretize.h"
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
-#ifndef MUL_ELEMENTS
-#define MUL_ELEMENTS(x, y)  ((x) * (y))
-#endif
-#ifndef MUL_ELEMENTS_Q15
-#define MUL_ELEMENTS_Q15(x, y)  (MUL_ELEMENTS(x, y) >> 15)
-#endif
-#ifndef MUL_SUM_ELEMENTS_Q15
-#define MUL_SUM_ELEMENTS_Q15(x, y, z) ((z) + MUL_ELEMENTS_Q15((x), (y)))
-#endif
-#ifndef MUL_SUB_ELEMENTS_Q15
-#define MUL_SUB_ELEMENTS_Q15(x, y, z) ((z) - MUL_ELEMENTS_Q15((x), (y)))
-#endif
-
-#define F_TO_Q15(x)  (int32_t)((x) * (1 << 15))
-
-#define NUM_SIZE 3
-#define DEN_SIZE 3
-
-/* Numerator coefficients in Q15 */
-#define NUM0 F_TO_Q15(1.0)
-#define NUM1 F_TO_Q15(-1.3556955132594553)
-#define NUM2 F_TO_Q15(0.4263234504891082)
-
-/* Denominator coefficients in Q15 */
-#define DEN0 F_TO_Q15(1.0)
-#define DEN1 F_TO_Q15(-1.2158768596305372)
-#define DEN2 F_TO_Q15(0.28650479686019026)
+/* Lead-lag compensator with unity DC gain, zeros and poles in rad/s */
+#define PID_ZERO_1   (-30.123595373218766)
+#define PID_ZERO_2   (-134.84337486997623)
+#define PID_POLE_1   (-21.900436400779586)
+#define PID_POLE_2   (-206.20072515917087)
+#define PID_DC_GAIN  (1.0)
 
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
@@ -50,48 +29,115 @@
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
+/**
+ * @brief Point the filter at the active tuning and return it, read once per sample.
+ */
+static const pid_tuning_t *LoadTuning(pid_controller_t *pid);
+
+/**
+ * @brief Undo the gain shift of a tuning, saturating to the Q31 range.
+ */
+static int32_t ApplyGain(const pid_tuning_t *tuning, int32_t output);
+
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
 
-static int32_t input_buffer[NUM_SIZE] = {[0 ... (NUM_SIZE - 1)] = 0};
-static int32_t output_buffer[DEN_SIZE - 1] = {[0 ... (DEN_SIZE - 2)] = 0};
+/* The lead-lag has no integrator, the reference enters twice to reach unity DC gain with the plant */
+STATIC const pid_tuning_t pid_default_tuning = {
+    .coefs = {
+        DISCRETIZE_TUSTIN_ZPK_SOS(PID_ZERO_1, PID_ZERO_2, PID_POLE_1, PID_POLE_2, PID_DC_GAIN, DISCRETIZE_MS_TO_S(TS_MS)),
+    },
+    .gain_shift = 0,
+    .reference_weight = 2,
+};
+
+STATIC pid_controller_t pid_default = {
+    .tuning = &pid_default_tuning,
+    .filter = {
+        .coefs = pid_default_tuning.coefs,
+        .state = pid_default.state,
+        .num_stages = PID_NUM_STAGES,
+    },
+};
 
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
-int32_t PID_Reset() {
-    memset(input_buffer, 0, sizeof(input_buffer));
-    memset(output_buffer, 0, sizeof(output_buffer));
+bool_t PID_ControllerInit(pid_controller_t *pid, const pid_tuning_t *tuning) {
+    bool_t ret = FALSE;
+    if (pid != NULL) {
+        pid->tuning = (tuning != NULL) ? tuning : &pid_default_tuning;
+        ret = BIQUAD_Init(&pid->filter, pid->tuning->coefs, pid->state, PID_NUM_STAGES);
+    }
+    return ret;
 }
 
-int32_t PID_Filter(int32_t input) {
-    /* Shift values in the input buffer */
-    for (int i = NUM_SIZE - 1; i > 0; --i) {
-        input_buffer[i] = input_buffer[i - 1];
+void PID_ControllerReset(pid_controller_t *pid) {
+    BIQUAD_Reset(&pid->filter);
+}
+
+int32_t PID_ControllerFilter(pid_controller_t *pid, int32_t input) {
+    const pid_tuning_t *tuning = LoadTuning(pid);
+    return ApplyGain(tuning, BIQUAD_StepQ15(&pid->filter, input));
+}
+
+void PID_ControllerFilterBlock(pid_controller_t *pid, const int32_t *input, int32_t *output, size_t size) {
+    const pid_tuning_t *tuning = LoadTuning(pid);
+    BIQUAD_StepBlockQ15(&pid->filter, input, output, size);
+    for (size_t i = 0; i < size; i++) {
+        output[i] = ApplyGain(tuning, output[i]);
     }
-    input_buffer[0] = input;
+}
 
-    /* Calculate the numerator part */
-    int32_t output = 0;
-    output = MUL_SUM_ELEMENTS_Q15(NUM0, input_buffer[0], output);
-    output = MUL_SUM_ELEMENTS_Q15(NUM1, input_buffer[1], output);
-    output = MUL_SUM_ELEMENTS_Q15(NUM2, input_buffer[2], output);
+int32_t PID_ControllerStep(pid_controller_t *pid, int32_t reference, int32_t output) {
+    const pid_tuning_t *tuning = LoadTuning(pid);
+    int32_t error = (tuning->reference_weight * reference) - output;
+    return ApplyGain(tuning, BIQUAD_StepQ15(&pid->filter, error));
+}
 
-    /* Calculate the denominator part */
-    output = MUL_SUB_ELEMENTS_Q15(DEN1, output_buffer[0], output);
-    output = MUL_SUB_ELEMENTS_Q15(DEN2, output_buffer[1], output);
+void PID_ControllerSetTuning(pid_controller_t *pid, const pid_tuning_t *tuning) {
+    __atomic_store_n(&pid->tuning, (tuning != NULL) ? tuning : &pid_default_tuning, __ATOMIC_RELEASE);
+}
 
-    /* Shift values in the output buffer */
-    for (int i = DEN_SIZE - 2; i > 0; --i) {
-        output_buffer[i] = output_buffer[i - 1];
-    }
-    output_buffer[0] = output;
+int32_t PID_Reset() {
+    PID_ControllerReset(&pid_default);
+}
+
+int32_t PID_Filter(int32_t input) {
+    return PID_ControllerFilter(&pid_default, input);
+}
+
+void PID_FilterBlock(const int32_t *input, int32_t *output, size_t size) {
+    PID_ControllerFilterBlock(&pid_default, input, output, size);
+}
 
-    return output;
+int32_t PID_Step(int32_t reference, int32_t output) {
+    return PID_ControllerStep(&pid_default, reference, output);
+}
+
+void PID_SetTuning(const pid_tuning_t *tuning) {
+    PID_ControllerSetTuning(&pid_default, tuning);
 }
 
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
+static const pid_tuning_t *LoadTuning(pid_controller_t *pid) {
+    const pid_tuning_t *tuning = __atomic_load_n(&pid->tuning, __ATOMIC_ACQUIRE);
+    pid->filter.coefs = tuning->coefs;
+    return tuning;
+}
+
+static int32_t ApplyGain(const pid_tuning_t *tuning, int32_t output) {
+    int64_t value = (int64_t)output * (1LL << tuning->gain_shift);
+    if (value > INT32_MAX) {
+        value = INT32_MAX;
+    }
+    else if (value < INT32_MIN) {
+        value = INT32_MIN;
+    }
+    return (int32_t)value;
+}
+
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
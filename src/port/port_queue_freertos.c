@@ -20,6 +20,29 @@
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
 
+/**
+ * @brief Copy the items that fit into the queue. Call inside a critical section.
+ *
+ * The interrupt safe primitives take no lock of their own beyond the nested
+ * mask, and only the first item can find a task waiting, so it is woken once.
+ */
+static uint16_t SendLocked(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, BaseType_t *woken);
+
+/**
+ * @brief Copy the items waiting out of the queue. Call inside a critical section.
+ */
+static uint16_t ReceiveLocked(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, BaseType_t *woken);
+
+/**
+ * @brief Send the items that fit under one critical section and yield once if a task was woken.
+ */
+static uint16_t SendAvailable(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count);
+
+/**
+ * @brief Receive the items waiting under one critical section and yield once if a task was woken.
+ */
+static uint16_t ReceiveAvailable(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count);
+
 /*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
 
 /*========= [LOCAL VARIABLES] ==================================================*/
@@ -74,6 +97,107 @@ bool_t PORT_QUEUE_ReceiveFromISR(osal_queue_handle_t handler, void *data, bool_t
     return ret;
 }
 
+uint16_t PORT_QUEUE_SendN(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, port_tick_t wait_time) {
+    uint16_t sent = 0;
+    if (count == 1) {
+        sent = PORT_QUEUE_Send(handler, (void *)data, wait_time) ? 1 : 0;
+    }
+    else if (count > 1) {
+        sent = SendAvailable(handler, data, data_size, count);
+        if ((sent == 0) && (wait_time > 0)) {
+            // Block for the first one outside the critical section, then the rest in one go
+            if (xQueueSend(handler, (void *)data, wait_time) == pdTRUE) {
+                sent = 1 + SendAvailable(handler, &data[data_size], data_size, count - 1);
+            }
+        }
+    }
+    return sent;
+}
+
+uint16_t PORT_QUEUE_ReceiveN(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, port_tick_t wait_time) {
+    uint16_t received = 0;
+    if (count == 1) {
+        received = PORT_QUEUE_Receive(handler, data, wait_time) ? 1 : 0;
+    }
+    else if (count > 1) {
+        received = ReceiveAvailable(handler, data, data_size, count);
+        if ((received == 0) && (wait_time > 0)) {
+            if (xQueueReceive(handler, data, wait_time) == pdTRUE) {
+                received = 1 + ReceiveAvailable(handler, &data[data_size], data_size, count - 1);
+            }
+        }
+    }
+    return received;
+}
+
+uint16_t PORT_QUEUE_SendNFromISR(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, bool_t *yield_need) {
+    uint16_t sent = 0;
+    if (count == 1) {
+        sent = PORT_QUEUE_SendFromISR(handler, (void *)data, yield_need) ? 1 : 0;
+    }
+    else {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t saved_mask = taskENTER_CRITICAL_FROM_ISR();
+        sent = SendLocked(handler, data, data_size, count, &xHigherPriorityTaskWoken);
+        taskEXIT_CRITICAL_FROM_ISR(saved_mask);
+        *yield_need = (xHigherPriorityTaskWoken) ? TRUE : FALSE;
+    }
+    return sent;
+}
+
+uint16_t PORT_QUEUE_ReceiveNFromISR(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, bool_t *yield_need) {
+    uint16_t received = 0;
+    if (count == 1) {
+        received = PORT_QUEUE_ReceiveFromISR(handler, data, yield_need) ? 1 : 0;
+    }
+    else {
+        BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+        UBaseType_t saved_mask = taskENTER_CRITICAL_FROM_ISR();
+        received = ReceiveLocked(handler, data, data_size, count, &xHigherPriorityTaskWoken);
+        taskEXIT_CRITICAL_FROM_ISR(saved_mask);
+        *yield_need = (xHigherPriorityTaskWoken) ? TRUE : FALSE;
+    }
+    return received;
+}
+
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
 
+static uint16_t SendLocked(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count, BaseType_t *woken) {
+    uint16_t sent = 0;
+    while ((sent < count) && (xQueueSendFromISR(handler, (void *)&data[sent * data_size], woken) == pdTRUE)) {
+        sent++;
+    }
+    return sent;
+}
+
+static uint16_t ReceiveLocked(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count, BaseType_t *woken) {
+    uint16_t received = 0;
+    while ((received < count) && (xQueueReceiveFromISR(handler, &data[received * data_size], woken) == pdTRUE)) {
+        received++;
+    }
+    return received;
+}
+
+static uint16_t SendAvailable(osal_queue_handle_t handler, const uint8_t *data, uint32_t data_size, uint16_t count) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    taskENTER_CRITICAL();
+    uint16_t sent = SendLocked(handler, data, data_size, count, &xHigherPriorityTaskWoken);
+    taskEXIT_CRITICAL();
+    if (xHigherPriorityTaskWoken) {
+        taskYIELD();
+    }
+    return sent;
+}
+
+static uint16_t ReceiveAvailable(osal_queue_handle_t handler, uint8_t *data, uint32_t data_size, uint16_t count) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    taskENTER_CRITICAL();
+    uint16_t received = ReceiveLocked(handler, data, data_size, count, &xHigherPriorityTaskWoken);
+    taskEXIT_CRITICAL();
+    if (xHigherPriorityTaskWoken) {
+        taskYIELD();
+    }
+    return received;
+}
+
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -32,6 +32,34 @@ osal_task_handler_t PORT_TASK_CreateStaticTask(OSAL_TASK_Callback_t function, ch
     return ((osal_task_handler_t) xTaskCreateStatic(function, name, size, context, (UBaseType_t)(tskIDLE_PRIORITY + priority), stack_ptr, task_hold_ptr));
 }
 
+void PORT_TASK_NotifyGive(osal_task_handler_t handler) {
+    xTaskNotifyGive(handler);
+}
+
+void PORT_TASK_NotifyGiveFromISR(osal_task_handler_t handler, bool_t *yield_need) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(handler, &xHigherPriorityTaskWoken);
+    *yield_need = (xHigherPriorityTaskWoken) ? TRUE : FALSE;
+}
+
+uint32_t PORT_TASK_NotifyTake(bool_t clear, port_tick_t wait_time) {
+    return (uint32_t)ulTaskNotifyTake(clear ? pdTRUE : pdFALSE, wait_time);
+}
+
+void PORT_TASK_NotifySetBits(osal_task_handler_t handler, uint32_t bits) {
+    xTaskNotify(handler, bits, eSetBits);
+}
+
+void PORT_TASK_NotifySetBitsFromISR(osal_task_handler_t handler, uint32_t bits, bool_t *yield_need) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    xTaskNotifyFromISR(handler, bits, eSetBits, &xHigherPriorityTaskWoken);
+    *yield_need = (xHigherPriorityTaskWoken) ? TRUE : FALSE;
+}
+
+bool_t PORT_TASK_NotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t *bits, port_tick_t wait_time) {
+    return (xTaskNotifyWait(clear_on_entry, clear_on_exit, bits, wait_time) == pdTRUE) ? TRUE : FALSE;
+}
+
 // #if (configSUPPORT_STATIC_ALLOCATION == 1)
 
 // /* configUSE_STATIC_ALLOCATION is set to 1, so the application must provide an
@@ -0,0 +1,149 @@
+/**
+ * @file port_time_freertos.c
+ * @author Marcos Dominguez
+ *
+ * @brief Port for the 64 bit monotonic clock.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "port_time_freertos.h"
+
+#ifndef TEST
+#include "chip.h"
+#else
+#include "FreeRTOS_task_simulated.h"
+#include <time.h>
+#endif
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#ifndef TEST
+#define RIT_IRQ_PRIORITY    0   /**< Above configMAX_SYSCALL_INTERRUPT_PRIORITY, the kernel never masks it. */
+#define LOW_HALF            0x80000000UL
+#else
+#define HOST_NS_PER_US      1000U
+#define HOST_NS_PER_TICK    ((uint64_t)OSAL_TICK_PERIOD_US * HOST_NS_PER_US)
+#endif
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+#ifdef TEST
+/**
+ * @brief Nanoseconds of the monotonic clock of the host.
+ */
+static uint64_t HostNs(void);
+#endif
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+#ifndef TEST
+/**
+ * @brief Count an overflow of the RIT counter.
+ */
+void RIT_IRQHandler(void);
+#endif
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static bool_t initialized = FALSE;
+
+static uint32_t cycles_per_us = 1;
+
+#ifndef TEST
+static volatile uint32_t overflows = 0;     /**< High word of the clock. */
+#else
+static uint64_t ticks = 0;                  /**< Simulated ticks, extended to 64 bits. */
+static TickType_t last_tick = 0;            /**< Tick count of the last read. */
+static uint64_t tick_host_ns = 0;           /**< Host time when last_tick was first seen. */
+#endif
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+void PORT_TIME_Init(void) {
+    if (!initialized) {
+        initialized = TRUE;
+        #ifndef TEST
+        Chip_Clock_Enable(CLK_MX_RITIMER);
+        LPC_RITIMER->CTRL = 0;
+        LPC_RITIMER->MASK = 0;
+        LPC_RITIMER->COMPVAL = 0xFFFFFFFFUL;
+        LPC_RITIMER->COUNTER = 0;
+        cycles_per_us = Chip_Clock_GetRate(CLK_MX_RITIMER) / 1000000UL;
+        NVIC_SetPriority(RITIMER_IRQn, RIT_IRQ_PRIORITY);
+        NVIC_ClearPendingIRQ(RITIMER_IRQn);
+        NVIC_EnableIRQ(RITIMER_IRQn);
+        // No clear on match, the counter wraps by itself. Keep counting while halted by the debugger.
+        LPC_RITIMER->CTRL = RIT_CTRL_INT | RIT_CTRL_TEN;
+        #else
+        cycles_per_us = HOST_NS_PER_US;
+        last_tick = xTaskGetTickCount();
+        ticks = last_tick;
+        tick_host_ns = HostNs();
+        #endif
+    }
+}
+
+port_time_t PORT_TIME_GetCycles(void) {
+    #ifndef TEST
+    uint32_t high;
+    uint32_t low;
+    uint32_t pending;
+    do {
+        high = overflows;
+        low = LPC_RITIMER->COUNTER;
+        pending = LPC_RITIMER->CTRL & RIT_CTRL_INT;
+    } while (high != overflows);
+    if (pending && (low < LOW_HALF)) {
+        // Wrapped with the interrupt masked, the ISR did not count it yet
+        high++;
+    }
+    return ((port_time_t)high << 32) | low;
+    #else
+    TickType_t tick = xTaskGetTickCount();
+    uint64_t host = HostNs();
+    if (tick != last_tick) {
+        ticks += (TickType_t)(tick - last_tick);
+        last_tick = tick;
+        tick_host_ns = host;
+    }
+    uint64_t inside = host - tick_host_ns;
+    if (inside >= HOST_NS_PER_TICK) {
+        inside = HOST_NS_PER_TICK - 1;
+    }
+    return (ticks * HOST_NS_PER_TICK) + inside;
+    #endif
+}
+
+uint32_t PORT_TIME_CyclesPerUs(void) {
+    return cycles_per_us;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+#ifdef TEST
+static uint64_t HostNs(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec;
+}
+#endif
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
+
+#ifndef TEST
+void RIT_IRQHandler(void) {
+    // The match is at 0xFFFFFFFF, the counter wrapped before the entry latency ends
+    LPC_RITIMER->CTRL |= RIT_CTRL_INT;
+    overflows++;
+}
+#endif
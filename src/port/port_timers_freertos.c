@@ -20,16 +20,6 @@
 
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
-/**
- * @brief Structure to hold information about a FreeRTOS timer.
- *
- */
-typedef struct {
-    TimerHandle_t handler;       /**< FreeRTOS timer handle. */
-    UtilsCallback_t callback;    /**< Callback function to be executed when the timer expires. */
-    void *context;               /**< Context to be passed to the callback function. */
-} port_timer_t;
-
 /*========= [TASK DECLARATIONS] ================================================*/
 
 /*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
@@ -39,8 +29,8 @@ typedef struct {
 /**
  * @brief Callback function for FreeRTOS timers.
  *
- * This function is called when a FreeRTOS timer expires. It finds the corresponding timer in the timers_active array
- * and executes its callback function.
+ * This function is called when a FreeRTOS timer expires. The ID of the timer points to its callback,
+ * so it is found without searching.
  *
  * @param xTimer The handle of the timer that expired.
  */
@@ -48,21 +38,12 @@ void TimerCallback(TimerHandle_t xTimer);
 
 /*========= [LOCAL VARIABLES] ==================================================*/
 
-port_timer_t timers_active[TIMER_INDEX_QTY] = {[0 ... (TIMER_INDEX_QTY - 1)] = {.callback = NULL}}; /**< Array to store information about active FreeRTOS timers. */
-
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
-port_timers_handler_t PORT_TIMER_Create(const char *name, port_tick_t time, bool_t repeat, PortSWTimerCallback_t *Callback, port_timers_holder_t *holder_ptr, timer_index_t index) {
-    port_timers_handler_t handler = NULL;
-    if (index < TIMER_INDEX_QTY) {
-        timers_active[index].callback = Callback->callback;
-        timers_active[index].context = Callback->context;
-        timers_active[index].handler = xTimerCreateStatic(name, time, repeat & pdTRUE, NULL, TimerCallback, holder_ptr);
-        handler = timers_active[index].handler;
-    }
-    return handler;
+port_timers_handler_t PORT_TIMER_Create(const char *name, port_tick_t time, bool_t repeat, PortSWTimerCallback_t *Callback, port_timers_holder_t *holder_ptr) {
+    return xTimerCreateStatic(name, time, repeat & pdTRUE, Callback, TimerCallback, holder_ptr);
 }
 
 // #if (configSUPPORT_STATIC_ALLOCATION == 1)
@@ -103,19 +84,9 @@ port_timers_handler_t PORT_TIMER_Create(const char *name, port_tick_t time, bool
 /*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
 
 void TimerCallback(port_timers_handler_t xTimer) {
-    timer_index_t index = 0;
-    while (index < TIMER_INDEX_QTY) {
-        if (timers_active[index].handler == xTimer) {
-            break;
-        }
-        else {
-            index++;
-        }
-    }
-    if (index < TIMER_INDEX_QTY) {
-        if (timers_active[index].callback != NULL) {
-            timers_active[index].callback(timers_active[index].context);
-        }
+    PortSWTimerCallback_t *Callback = pvTimerGetTimerID(xTimer);
+    if ((Callback != NULL) && (Callback->callback != NULL)) {
+        Callback->callback(Callback->context);
     }
 }
 
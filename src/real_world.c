@@ -13,6 +13,7 @@
 #include "real_world.h"
 #include "osal_task.h"
 #include "real_world_filter.h"
+#include "control_config.h"
 #include <string.h>
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
@@ -80,7 +81,7 @@ STATIC void TaskRealWorld(void *not_used) {
     #endif
     {
         real_world.output = REAL_WORLD_FILTER_Filter(real_world.input);
-        OSAL_TASK_Delay(OSAL_MS_TO_TICKS(5));
+        OSAL_TASK_Delay(OSAL_MS_TO_TICKS(TS_MS));
     }
 }
 
@@ -11,37 +11,17 @@
 /*========= [DEPENDENCIES] =====================================================*/
 
 #include "real_world_filter.h"
-#include <string.h>
-
+#include "control_config.h"
+#include "discretize.h"
 
 /*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
 
-#ifndef MUL_ELEMENTS
-#define MUL_ELEMENTS(x, y)  ((x) * (y))
-#endif
-#ifndef MUL_ELEMENTS_Q15
-#define MUL_ELEMENTS_Q15(x, y)  (MUL_ELEMENTS(x, y) >> 15)
-#endif
-#ifndef MUL_SUM_ELEMENTS_Q15
-#define MUL_SUM_ELEMENTS_Q15(x, y, z) ((z) + MUL_ELEMENTS_Q15((x), (y)))
-#endif
-#ifndef MUL_SUB_ELEMENTS_Q15
-#define MUL_SUB_ELEMENTS_Q15(x, y, z) ((z) - MUL_ELEMENTS_Q15((x), (y)))
-#endif
-
-#define F_TO_Q15(x)  (int32_t)((x) * (1 << 15))
-
-#define NUM_SIZE 2
-#define DEN_SIZE 3
-
-/* Numerator coefficients in Q15 */
-#define NUM0 F_TO_Q15(0.04976845243756167)
-#define NUM1 F_TO_Q15(0.035050642374672925)
-
-/* Denominator coefficients in Q15 */
-#define DEN0 F_TO_Q15(1.0)
-#define DEN1 F_TO_Q15(-1.2631799459800208)
-#define DEN2 F_TO_Q15(0.34799904079225535)
+/* Plant with two real poles in rad/s and its DC gain */
+#define PLANT_POLE_1    (-30.81319973847941)
+#define PLANT_POLE_2    (-180.29791137263163)
+#define PLANT_DC_GAIN   (1.0)
+
+#define PLANT_TS        DISCRETIZE_MS_TO_S(TS_MS)
 
 /*========= [PRIVATE DATA TYPES] ===============================================*/
 
@@ -53,41 +33,59 @@
 
 /*========= [LOCAL VARIABLES] ==================================================*/
 
-static int32_t input_buffer[NUM_SIZE] = {[0 ... (NUM_SIZE - 1)] = 0};
-static int32_t output_buffer[DEN_SIZE - 1] = {[0 ... (DEN_SIZE - 2)] = 0};
+STATIC const int32_t plant_coefs[REAL_WORLD_FILTER_NUM_STAGES * BIQUAD_COEFS_PER_STAGE] = {
+    /* ZOH model advanced one sample: the output is read right after the DAC is written */
+    BIQUAD_COEF(DISCRETIZE_ZOH_2POLE_B1(PLANT_POLE_1, PLANT_POLE_2, PLANT_DC_GAIN, PLANT_TS)),
+    BIQUAD_COEF(DISCRETIZE_ZOH_2POLE_B2(PLANT_POLE_1, PLANT_POLE_2, PLANT_DC_GAIN, PLANT_TS)),
+    BIQUAD_COEF(0.0),
+    BIQUAD_COEF(DISCRETIZE_ZOH_2POLE_A1(PLANT_POLE_1, PLANT_POLE_2, PLANT_TS)),
+    BIQUAD_COEF(DISCRETIZE_ZOH_2POLE_A2(PLANT_POLE_1, PLANT_POLE_2, PLANT_TS)),
+};
+
+STATIC real_world_plant_t plant_default = {
+    .coefs = plant_coefs,
+    .filter = {
+        .coefs = plant_coefs,
+        .state = plant_default.state,
+        .num_stages = REAL_WORLD_FILTER_NUM_STAGES,
+    },
+};
 
 /*========= [STATE FUNCTION POINTERS] ==========================================*/
 
 /*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
 
-int32_t REAL_WORLD_FILTER_Reset() {
-    memset(input_buffer, 0, sizeof(input_buffer));
-    memset(output_buffer, 0, sizeof(output_buffer));
+bool_t REAL_WORLD_FILTER_PlantInit(real_world_plant_t *plant, const int32_t *coefs) {
+    bool_t ret = FALSE;
+    if (plant != NULL) {
+        plant->coefs = (coefs != NULL) ? coefs : plant_coefs;
+        ret = BIQUAD_Init(&plant->filter, plant->coefs, plant->state, REAL_WORLD_FILTER_NUM_STAGES);
+    }
+    return ret;
 }
 
-int32_t REAL_WORLD_FILTER_Filter(int32_t input) {
-    /* Shift values in the input buffer */
-    for (int i = NUM_SIZE - 1; i > 0; --i) {
-        input_buffer[i] = input_buffer[i - 1];
-    }
-    input_buffer[0] = input;
+void REAL_WORLD_FILTER_PlantReset(real_world_plant_t *plant) {
+    BIQUAD_Reset(&plant->filter);
+}
 
-    /* Calculate the numerator part */
-    int32_t output = 0;
-    output = MUL_SUM_ELEMENTS_Q15(NUM0, input_buffer[0], output);
-    output = MUL_SUM_ELEMENTS_Q15(NUM1, input_buffer[1], output);
+int32_t REAL_WORLD_FILTER_PlantFilter(real_world_plant_t *plant, int32_t input) {
+    return BIQUAD_StepQ15(&plant->filter, input);
+}
 
-    /* Calculate the denominator part */
-    output = MUL_SUB_ELEMENTS_Q15(DEN1, output_buffer[0], output);
-    output = MUL_SUB_ELEMENTS_Q15(DEN2, output_buffer[1], output);
+void REAL_WORLD_FILTER_PlantFilterBlock(real_world_plant_t *plant, const int32_t *input, int32_t *output, size_t size) {
+    BIQUAD_StepBlockQ15(&plant->filter, input, output, size);
+}
 
-    /* Shift values in the output buffer */
-    for (int i = DEN_SIZE - 2; i > 0; --i) {
-        output_buffer[i] = output_buffer[i - 1];
-    }
-    output_buffer[0] = output;
+int32_t REAL_WORLD_FILTER_Reset() {
+    REAL_WORLD_FILTER_PlantReset(&plant_default);
+}
+
+int32_t REAL_WORLD_FILTER_Filter(int32_t input) {
+    return REAL_WORLD_FILTER_PlantFilter(&plant_default, input);
+}
 
-    return output;
+void REAL_WORLD_FILTER_FilterBlock(const int32_t *input, int32_t *output, size_t size) {
+    REAL_WORLD_FILTER_PlantFilterBlock(&plant_default, input, output, size);
 }
 
 /*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
@@ -0,0 +1,95 @@
+/**
+ * @file rls.c
+ * @author Marcos Dominguez
+ *
+ * @brief Recursive least squares estimator with forgetting factor.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "rls.h"
+#include <string.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MUL_ELEMENTS(a, b) ((a)*(b))
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+bool_t RLS_Init(rls_t *rls, uint8_t num_params, float lambda, float p0) {
+    bool_t ret = FALSE;
+    if (rls != NULL) {
+        if ((num_params > 0) && (num_params <= RLS_MAX_PARAMS) && (lambda > 0.0f) && (lambda <= 1.0f)) {
+            rls->num_params = num_params;
+            rls->lambda = lambda;
+            RLS_Reset(rls, p0);
+            ret = TRUE;
+        }
+    }
+
+    return ret;
+}
+
+void RLS_Reset(rls_t *rls, float p0) {
+    memset(rls->theta, 0, sizeof(rls->theta));
+    memset(rls->P, 0, sizeof(rls->P));
+    for (uint8_t i = 0; i < rls->num_params; i++) {
+        rls->P[i][i] = p0;
+    }
+}
+
+float RLS_Update(rls_t *rls, const float *phi, float y) {
+    uint8_t n = rls->num_params;
+    float P_phi[RLS_MAX_PARAMS];
+    float gain[RLS_MAX_PARAMS];
+
+    // Prediction error and P phi
+    float error = y;
+    float denominator = rls->lambda;
+    for (uint8_t i = 0; i < n; i++) {
+        error -= MUL_ELEMENTS(phi[i], rls->theta[i]);
+        P_phi[i] = 0.0f;
+        for (uint8_t j = 0; j < n; j++) {
+            P_phi[i] += MUL_ELEMENTS(rls->P[i][j], phi[j]);
+        }
+        denominator += MUL_ELEMENTS(phi[i], P_phi[i]);
+    }
+
+    // Gain and new parameters
+    float inv_denominator = 1.0f / denominator;
+    for (uint8_t i = 0; i < n; i++) {
+        gain[i] = MUL_ELEMENTS(P_phi[i], inv_denominator);
+        rls->theta[i] += MUL_ELEMENTS(gain[i], error);
+    }
+
+    // P = (P - gain phi' P) / lambda, computed on the upper triangle and mirrored to stay symmetric
+    float inv_lambda = 1.0f / rls->lambda;
+    for (uint8_t i = 0; i < n; i++) {
+        for (uint8_t j = i; j < n; j++) {
+            float value = MUL_ELEMENTS(rls->P[i][j] - MUL_ELEMENTS(gain[i], P_phi[j]), inv_lambda);
+            rls->P[i][j] = value;
+            rls->P[j][i] = value;
+        }
+    }
+
+    return error;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
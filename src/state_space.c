@@ -0,0 +1,51 @@
+/**
+ * @file state_space.c
+ * @author Marcos Dominguez
+ *
+ * @brief Arithmetic shared by the state space controllers and observers.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "state_space.h"
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define MV_PER_V    1000
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+state_space_real_t STATE_SPACE_FromMv(int32_t mv) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return (int32_t)(STATE_SPACE_ToAcc(mv) / MV_PER_V);
+    #else
+    return (state_space_real_t)mv / STATE_SPACE_REAL(MV_PER_V);
+    #endif
+}
+
+int32_t STATE_SPACE_ToMv(state_space_real_t value) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return (int32_t)(((int64_t)value * MV_PER_V) / (1LL << STATE_SPACE_FRAC_BITS));
+    #else
+    return (int32_t)(value * STATE_SPACE_REAL(MV_PER_V));
+    #endif
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,117 @@
+/**
+ * @file telemetry.c
+ * @author Marcos Dominguez
+ *
+ * @brief Telemetry of the control loop.
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "telemetry.h"
+#include "osal_task.h"
+#include "osal_spsc.h"
+#include "task_manager.h"
+
+#include <stdio.h>
+#ifndef TEST
+#include "sapi.h"
+#else
+#define UART_USB 1
+#define uartWriteString(UART_USB, str) printf("%s",str)
+#endif
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#if (TELEMETRY_RING_SIZE & (TELEMETRY_RING_SIZE - 1))
+#error "TELEMETRY_RING_SIZE must be a power of 2"
+#endif
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+STATIC void TELEMETRY_Drain(void *not_used);
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+STATIC osal_spsc_t telemetry_ring;
+
+STATIC uint32_t telemetry_dropped = 0;      /**< Records lost with the ring full. */
+
+STATIC uint32_t telemetry_high_water = 0;   /**< Highest number of records waiting. */
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+void TELEMETRY_Init(void) {
+    static osal_task_t telemetry_task = {.name = "telemetry"};
+    static osal_stack_holder_t telemetry_stack[STACK_SIZE_TELEMETRY];
+    static osal_task_holder_t telemetry_holder;
+    static uint8_t telemetry_storage[OSAL_SPSC_StorageSize(sizeof(telemetry_record_t), TELEMETRY_RING_SIZE)];
+    if (telemetry_task.task_handler == NULL) {
+        OSAL_SPSC_LoadStruct(&telemetry_ring, telemetry_storage, sizeof(telemetry_record_t), TELEMETRY_RING_SIZE);
+        OSAL_TASK_LoadStruct(&telemetry_task, telemetry_stack, &telemetry_holder, STACK_SIZE_TELEMETRY);
+        OSAL_TASK_Create(&telemetry_task, TELEMETRY_Drain, NULL, TASK_PRIORITY_LOW);
+        OSAL_SPSC_SetConsumer(&telemetry_ring, &telemetry_task);
+    }
+}
+
+bool_t TELEMETRY_Push(uint32_t tick, int32_t reference, int32_t u, int32_t y) {
+    telemetry_record_t record = {
+        .tick = tick,
+        .reference = reference,
+        .u = u,
+        .y = y,
+    };
+    bool_t ret = OSAL_SPSC_Push(&telemetry_ring, &record);
+    if (ret) {
+        uint32_t used = OSAL_SPSC_Count(&telemetry_ring);
+        if (used > telemetry_high_water) {
+            telemetry_high_water = used;
+        }
+    }
+    else {
+        telemetry_dropped++;
+    }
+
+    return ret;
+}
+
+bool_t TELEMETRY_Pop(telemetry_record_t *record) {
+    return OSAL_SPSC_Pop(&telemetry_ring, record);
+}
+
+uint32_t TELEMETRY_GetDropped(void) {
+    return telemetry_dropped;
+}
+
+uint32_t TELEMETRY_GetHighWater(void) {
+    return telemetry_high_water;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+STATIC void TELEMETRY_Drain(void *not_used) {
+    #ifndef TEST
+    while (TRUE)
+    #endif
+    {
+        telemetry_record_t record;
+        static char str[64];
+        while (TELEMETRY_Pop(&record)) {
+            sprintf(str, "%d,%d,%d,%.d\n", (int)record.tick, (int)record.reference, (int)record.u, (int)record.y);
+            uartWriteString(UART_USB, str);
+        }
+        OSAL_SPSC_Wait(&telemetry_ring, OSAL_MAX_DELAY);
+    }
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,550 @@
+/**
+ * @file arx_offline.c
+ * @author Marcos Dominguez
+ *
+ * @brief Offline ARX identification over captured telemetry logs, for the host.
+ *
+ * Reads the tick,reference,u,y lines the controllers print (mV, 5 ms apart),
+ * fits an ARX model over sliding windows and prints one line per window with
+ * the polynomials, the RMS of the one step residual and the fit in percent.
+ * The regressor and the least squares are arx.c and least_squares.c, the same
+ * code the identification runs on the board.
+ *
+ * The file is memory mapped and split between the threads at line
+ * boundaries. Each thread parses its part and accumulates the normal
+ * equations of every segment of -s samples; the regressor of a part starts
+ * from the last samples of the previous one. A window is the merge of -w / -s
+ * consecutive segments, so the cost does not depend on the overlap. Lines that
+ * are not four integers (reports, boot messages) are skipped, and an empty
+ * field reads as 0.
+ *
+ * Build from the root of the repository:
+ *
+ *     gcc -O2 -std=gnu11 -pthread -Iinc tools/arx_offline.c src/arx.c src/least_squares.c src/linalg.c -lm -o arx_offline
+ *
+ * Usage:
+ *
+ *     arx_offline [-a na] [-b nb] [-k nk] [-w window] [-s step] [-j threads] capture.csv
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "arx.h"
+#include "least_squares.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define DEFAULT_NA      2
+#define DEFAULT_NB      3
+#define DEFAULT_NK      0
+#define DEFAULT_WINDOW  12000   /**< One minute at 5 ms. */
+#define DEFAULT_STEP    3000    /**< 15 s between windows. */
+
+#define MAX_THREADS     256
+
+#define FIELDS          4       /**< tick, reference, u, y */
+
+#define MV_TO_V(x)      ((float)(x) / 1000.0f)
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/**
+ * @brief One line of the capture.
+ */
+typedef struct {
+    uint32_t tick;
+    int32_t u;      /**< Control action in mV */
+    int32_t y;      /**< Output in mV */
+} sample_t;
+
+/**
+ * @brief Statistics of step consecutive samples.
+ */
+typedef struct {
+    least_squares_t ls;
+    double sum_y;           /**< For the variance of the output */
+    uint32_t first_tick;
+    uint32_t last_tick;
+} segment_t;
+
+/**
+ * @brief Fit of one window.
+ */
+typedef struct {
+    float theta[LEAST_SQUARES_MAX_PARAMS];
+    double rmse;            /**< RMS of the one step residual in V */
+    double fit;             /**< 100 (1 - |residual| / |y - mean(y)|) */
+    uint32_t samples;
+    bool_t valid;
+} window_fit_t;
+
+/**
+ * @brief Configuration shared by every thread.
+ */
+typedef struct {
+    uint8_t na;
+    uint8_t nb;
+    uint8_t nk;
+    uint32_t window;        /**< Samples of a window, a multiple of step */
+    uint32_t step;          /**< Samples between windows */
+    const char *map;        /**< Whole capture */
+    size_t map_size;
+} config_t;
+
+/**
+ * @brief Part of the work of one thread.
+ */
+typedef struct {
+    const config_t *config;
+    const char *begin;      /**< First line of the part */
+    const char *end;        /**< One past the last line of the part */
+    uint64_t first_index;   /**< Global index of the first sample of the part */
+    uint64_t count;         /**< Samples of the part */
+    segment_t *segments;    /**< Segments owned only by this part are written here */
+    segment_t head;         /**< First segment, it may be shared with the previous part */
+    segment_t tail;         /**< Last segment, it may be shared with the next part */
+    uint64_t window_begin;  /**< Windows solved by this thread */
+    uint64_t window_end;
+    window_fit_t *fits;
+    uint64_t segment_qty;
+} worker_t;
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Parse one line.
+ *
+ * @param p             Start of the line.
+ * @param end           End of the capture.
+ * @param sample        Values of a valid line.
+ * @param valid         TRUE if the line is four integers.
+ * @return const char*  Start of the next line.
+ */
+static const char *ParseLine(const char *p, const char *end, sample_t *sample, bool_t *valid);
+
+/**
+ * @brief Start of the line before the one that starts at p, or NULL at the start of the capture.
+ */
+static const char *PreviousLine(const char *map, const char *p);
+
+static void *CountThread(void *arg);
+
+static void *AccumulateThread(void *arg);
+
+static void *SolveThread(void *arg);
+
+static void SegmentInit(segment_t *segment, uint8_t num_params);
+
+static void SegmentMerge(segment_t *segment, const segment_t *other);
+
+static void Usage(const char *name);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+int main(int argc, char *argv[]) {
+    config_t config = {
+        .na = DEFAULT_NA,
+        .nb = DEFAULT_NB,
+        .nk = DEFAULT_NK,
+        .window = DEFAULT_WINDOW,
+        .step = DEFAULT_STEP,
+    };
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int option;
+
+    while ((option = getopt(argc, argv, "a:b:k:w:s:j:h")) != -1) {
+        switch (option) {
+            case 'a': config.na = (uint8_t)atoi(optarg); break;
+            case 'b': config.nb = (uint8_t)atoi(optarg); break;
+            case 'k': config.nk = (uint8_t)atoi(optarg); break;
+            case 'w': config.window = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's': config.step = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'j': threads = atol(optarg); break;
+            default: Usage(argv[0]); return EXIT_FAILURE;
+        }
+    }
+    if (optind != argc - 1) {
+        Usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    arx_t probe;
+    if (!ARX_Init(&probe, config.na, config.nb, config.nk, 0)) {
+        fprintf(stderr, "invalid model: na + nb up to %d, nb at least 1, nk up to %d\n", ARX_MAX_PARAMS, ARX_MAX_DELAY);
+        return EXIT_FAILURE;
+    }
+    uint8_t num_params = ARX_NumParams(&probe);
+    if ((config.step == 0) || (config.window < config.step) || ((config.window % config.step) != 0)) {
+        fprintf(stderr, "the window must be a multiple of the step\n");
+        return EXIT_FAILURE;
+    }
+    if (threads < 1) {
+        threads = 1;
+    }
+    else if (threads > MAX_THREADS) {
+        threads = MAX_THREADS;
+    }
+
+    int fd = open(argv[optind], O_RDONLY);
+    struct stat st;
+    if ((fd < 0) || (fstat(fd, &st) != 0)) {
+        fprintf(stderr, "%s: %s\n", argv[optind], strerror(errno));
+        return EXIT_FAILURE;
+    }
+    if (st.st_size == 0) {
+        fprintf(stderr, "%s: empty\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+    config.map_size = (size_t)st.st_size;
+    config.map = mmap(NULL, config.map_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (config.map == MAP_FAILED) {
+        fprintf(stderr, "mmap: %s\n", strerror(errno));
+        return EXIT_FAILURE;
+    }
+    madvise((void *)config.map, config.map_size, MADV_SEQUENTIAL);
+
+    // Split at line boundaries
+    static worker_t workers[MAX_THREADS];
+    static pthread_t ids[MAX_THREADS];
+    const char *map_end = config.map + config.map_size;
+    const char *begin = config.map;
+    for (long t = 0; t < threads; t++) {
+        const char *end = config.map + (config.map_size * (t + 1)) / threads;
+        if (end < begin) {
+            end = begin;
+        }
+        while ((end < map_end) && (end > config.map) && (end[-1] != '\n')) {
+            end++;
+        }
+        workers[t].config = &config;
+        workers[t].begin = begin;
+        workers[t].end = end;
+        begin = end;
+    }
+
+    // First pass: samples of each part, so every part knows the index of its first sample
+    for (long t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, CountThread, &workers[t]);
+    }
+    uint64_t total = 0;
+    for (long t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        workers[t].first_index = total;
+        total += workers[t].count;
+    }
+    if (total == 0) {
+        fprintf(stderr, "%s: no samples\n", argv[optind]);
+        return EXIT_FAILURE;
+    }
+
+    // Second pass: normal equations of every segment
+    uint64_t segment_qty = (total + config.step - 1) / config.step;
+    segment_t *segments = malloc(segment_qty * sizeof(segment_t));
+    if (segments == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+    for (uint64_t i = 0; i < segment_qty; i++) {
+        SegmentInit(&segments[i], num_params);
+    }
+    for (long t = 0; t < threads; t++) {
+        workers[t].segments = segments;
+        SegmentInit(&workers[t].head, num_params);
+        SegmentInit(&workers[t].tail, num_params);
+        pthread_create(&ids[t], NULL, AccumulateThread, &workers[t]);
+    }
+    for (long t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    for (long t = 0; t < threads; t++) {
+        worker_t *w = &workers[t];
+        if (w->count > 0) {
+            uint64_t first = w->first_index / config.step;
+            uint64_t last = (w->first_index + w->count - 1) / config.step;
+            SegmentMerge(&segments[first], &w->head);
+            if (last != first) {
+                SegmentMerge(&segments[last], &w->tail);
+            }
+        }
+    }
+
+    // Windows, each the merge of window / step segments
+    uint64_t per_window = config.window / config.step;
+    uint64_t window_qty = (segment_qty > per_window) ? (segment_qty - per_window + 1) : 1;
+    window_fit_t *fits = calloc(window_qty, sizeof(window_fit_t));
+    if (fits == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+    for (long t = 0; t < threads; t++) {
+        workers[t].fits = fits;
+        workers[t].segment_qty = segment_qty;
+        workers[t].window_begin = (window_qty * t) / threads;
+        workers[t].window_end = (window_qty * (t + 1)) / threads;
+        pthread_create(&ids[t], NULL, SolveThread, &workers[t]);
+    }
+    for (long t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+
+    printf("start_tick,end_tick,samples");
+    for (uint8_t i = 1; i <= config.na; i++) {
+        printf(",a%u", i);
+    }
+    for (uint8_t i = 0; i < config.nb; i++) {
+        printf(",b%u", i);
+    }
+    printf(",rmse,fit\n");
+    for (uint64_t w = 0; w < window_qty; w++) {
+        uint64_t last = w + per_window - 1;
+        if (last >= segment_qty) {
+            last = segment_qty - 1;
+        }
+        printf("%u,%u,%u", segments[w].first_tick, segments[last].last_tick, fits[w].samples);
+        for (uint8_t i = 0; i < num_params; i++) {
+            if (fits[w].valid) {
+                printf(",%.6f", fits[w].theta[i]);
+            }
+            else {
+                printf(",nan");
+            }
+        }
+        printf(",%.6f,%.2f\n", fits[w].rmse, fits[w].fit);
+    }
+
+    fprintf(stderr, "%llu samples, %llu windows, %ld threads\n", (unsigned long long)total, (unsigned long long)window_qty, threads);
+    free(fits);
+    free(segments);
+    munmap((void *)config.map, config.map_size);
+
+    return EXIT_SUCCESS;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static const char *ParseLine(const char *p, const char *end, sample_t *sample, bool_t *valid) {
+    int64_t field[FIELDS] = {0};
+    uint8_t index = 0;
+    bool_t negative = FALSE;
+    bool_t digits = FALSE;
+    bool_t ok = TRUE;
+
+    while ((p < end) && (*p != '\n')) {
+        char c = *p++;
+        if ((c >= '0') && (c <= '9')) {
+            field[index] = field[index] * 10 + (c - '0');
+            digits = TRUE;
+        }
+        else if (c == ',') {
+            field[index] = negative ? -field[index] : field[index];
+            negative = FALSE;
+            index++;
+            if (index >= FIELDS) {
+                ok = FALSE;
+                break;
+            }
+        }
+        else if ((c == '-') && !negative && (field[index] == 0)) {
+            negative = TRUE;
+        }
+        else if (c != '\r') {
+            ok = FALSE;
+            break;
+        }
+    }
+    field[index] = negative ? -field[index] : field[index];
+    while ((p < end) && (*p != '\n')) {
+        p++;
+    }
+
+    *valid = (ok && digits && (index == FIELDS - 1)) ? TRUE : FALSE;
+    if (*valid) {
+        sample->tick = (uint32_t)field[0];
+        sample->u = (int32_t)field[2];
+        sample->y = (int32_t)field[3];
+    }
+
+    return (p < end) ? (p + 1) : end;
+}
+
+static const char *PreviousLine(const char *map, const char *p) {
+    const char *ret = NULL;
+    if (p > map) {
+        p--;    // The newline that ends the previous line
+        while ((p > map) && (p[-1] != '\n')) {
+            p--;
+        }
+        ret = p;
+    }
+
+    return ret;
+}
+
+static void *CountThread(void *arg) {
+    worker_t *w = arg;
+    const char *p = w->begin;
+    sample_t sample;
+    bool_t valid;
+
+    w->count = 0;
+    while (p < w->end) {
+        p = ParseLine(p, w->end, &sample, &valid);
+        if (valid) {
+            w->count++;
+        }
+    }
+
+    return NULL;
+}
+
+static void *AccumulateThread(void *arg) {
+    worker_t *w = arg;
+    const config_t *config = w->config;
+    const char *map_end = config->map + config->map_size;
+    sample_t sample;
+    bool_t valid;
+    arx_t arx;
+
+    if (w->count == 0) {
+        return NULL;
+    }
+    ARX_Init(&arx, config->na, config->nb, config->nk, 0);
+
+    // Fill the regressor with the last samples of the previous part, enough for every lag
+    uint16_t history = config->na + config->nb + config->nk;
+    const char *start = w->begin;
+    for (uint16_t found = 0; found < history;) {
+        const char *line = PreviousLine(config->map, start);
+        if (line == NULL) {
+            break;
+        }
+        ParseLine(line, map_end, &sample, &valid);
+        if (valid) {
+            found++;
+        }
+        start = line;
+    }
+    const char *p = start;
+    while (p < w->begin) {
+        p = ParseLine(p, w->begin, &sample, &valid);
+        if (valid) {
+            ARX_Regressor(&arx, MV_TO_V(sample.u));
+            ARX_Advance(&arx, MV_TO_V(sample.y), 0);
+        }
+    }
+
+    uint64_t index = w->first_index;
+    uint64_t last_index = w->first_index + w->count - 1;
+    uint64_t first_segment = w->first_index / config->step;
+    uint64_t last_segment = last_index / config->step;
+    while (p < w->end) {
+        p = ParseLine(p, w->end, &sample, &valid);
+        if (valid) {
+            uint64_t number = index / config->step;
+            segment_t *segment = (number == first_segment) ? &w->head :
+                                 (number == last_segment) ? &w->tail : &w->segments[number];
+            float u = MV_TO_V(sample.u);
+            float y = MV_TO_V(sample.y);
+
+            const float *phi = ARX_Regressor(&arx, u);
+            if (ARX_Ready(&arx)) {
+                LEAST_SQUARES_Add(&segment->ls, phi, y);
+                segment->sum_y += y;
+            }
+            ARX_Advance(&arx, y, 0);
+
+            if ((index % config->step) == 0) {
+                segment->first_tick = sample.tick;
+            }
+            if ((((index + 1) % config->step) == 0) || (index + 1 == w->first_index + w->count)) {
+                segment->last_tick = sample.tick;
+            }
+            index++;
+        }
+    }
+
+    return NULL;
+}
+
+static void *SolveThread(void *arg) {
+    worker_t *w = arg;
+    const config_t *config = w->config;
+    uint64_t per_window = config->window / config->step;
+    segment_t window;
+
+    for (uint64_t i = w->window_begin; i < w->window_end; i++) {
+        window_fit_t *fit = &w->fits[i];
+        SegmentInit(&window, w->segments[i].ls.num_params);
+        for (uint64_t j = i; (j < i + per_window) && (j < w->segment_qty); j++) {
+            SegmentMerge(&window, &w->segments[j]);
+        }
+
+        fit->samples = window.ls.count;
+        fit->valid = (window.ls.count > window.ls.num_params) ? LEAST_SQUARES_Solve(&window.ls, fit->theta) : FALSE;
+        if (fit->valid) {
+            double loss = LEAST_SQUARES_Loss(&window.ls, fit->theta);
+            double spread = window.ls.YTY - window.sum_y * window.sum_y / window.ls.count;
+            loss = (loss > 0) ? loss : 0;
+            fit->rmse = sqrt(loss / window.ls.count);
+            fit->fit = (spread > 0) ? 100.0 * (1.0 - sqrt(loss / spread)) : 0;
+        }
+        else {
+            fit->rmse = NAN;
+            fit->fit = NAN;
+        }
+    }
+
+    return NULL;
+}
+
+static void SegmentInit(segment_t *segment, uint8_t num_params) {
+    LEAST_SQUARES_Init(&segment->ls, num_params);
+    segment->sum_y = 0;
+    segment->first_tick = 0;
+    segment->last_tick = 0;
+}
+
+static void SegmentMerge(segment_t *segment, const segment_t *other) {
+    if (segment->ls.count == 0) {
+        segment->first_tick = other->first_tick;
+    }
+    if (other->ls.count > 0) {
+        segment->last_tick = other->last_tick;
+    }
+    LEAST_SQUARES_Merge(&segment->ls, &other->ls);
+    segment->sum_y += other->sum_y;
+}
+
+static void Usage(const char *name) {
+    fprintf(stderr, "usage: %s [-a na] [-b nb] [-k nk] [-w window] [-s step] [-j threads] capture.csv\n", name);
+    fprintf(stderr, "  -a  poles (%d)\n", DEFAULT_NA);
+    fprintf(stderr, "  -b  numerator coefficients (%d)\n", DEFAULT_NB);
+    fprintf(stderr, "  -k  dead time in samples (%d)\n", DEFAULT_NK);
+    fprintf(stderr, "  -w  samples of a window (%d)\n", DEFAULT_WINDOW);
+    fprintf(stderr, "  -s  samples between windows, divides the window (%d)\n", DEFAULT_STEP);
+    fprintf(stderr, "  -j  threads (one per core)\n");
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
@@ -0,0 +1,223 @@
+/**
+ * @file pole_placement_check.c
+ * @author Marcos Dominguez
+ *
+ * @brief Deviation of the observed pole placement loop from a double reference, for the host.
+ *
+ * Runs the observed controller of control.c against its own model as the
+ * plant, once with the pole_placement kernels in the STATE_SPACE_ARITHMETIC
+ * the program is built with and once in plain double, both fed with the
+ * same square reference. The plant and the reference loop are computed in
+ * double, so the difference is only the arithmetic of the kernels. The
+ * largest deviation of the control action and of the output is printed in
+ * mV, and the program fails when either is above the bound.
+ *
+ * Build and run from the root of the repository, once for each arithmetic:
+ *
+ *     for a in STATE_SPACE_DOUBLE STATE_SPACE_FLOAT STATE_SPACE_Q31; do
+ *         gcc -O2 -std=gnu11 -DTEST -DSTATE_SPACE_ARITHMETIC=$a -Iinc tools/pole_placement_check.c src/state_space.c -lm -o pole_placement_check && ./pole_placement_check || break
+ *     done
+ *
+ * Usage:
+ *
+ *     pole_placement_check [-b bound_mv] [-n samples]
+ *
+ * @version 0.1
+ * @date 2026-10-17
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "pole_placement.h"
+#include "control_config.h"
+#include "discretize.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define DEFAULT_BOUND_MV    0.5     /**< Largest deviation accepted, about half an LSB of the 12 bit ADC. */
+#define DEFAULT_SAMPLES     60000   /**< Five minutes at 5 ms. */
+
+#define SQUARE_PERIOD_MS    1000    /**< Reference between 2 V and 1 V, as PERIODO_SQUARE. */
+#define REFERENCE_HIGH      2.0
+#define REFERENCE_LOW       1.0
+
+#define MV_PER_V            1000.0
+
+/* Identified model of the plant, the one the observer of control.c uses */
+#define MODEL_A11   (-DISCRETIZE_ZOH_2POLE_A1(MODEL_POLE_1, MODEL_POLE_2, CONTROL_TS))
+#define MODEL_A12   (-DISCRETIZE_ZOH_2POLE_A2(MODEL_POLE_1, MODEL_POLE_2, CONTROL_TS))
+#define MODEL_A21   1.0
+#define MODEL_A22   0.0
+#define MODEL_B1    1.0
+#define MODEL_B2    0.0
+#define MODEL_C1    DISCRETIZE_ZOH_2POLE_B1(MODEL_POLE_1, MODEL_POLE_2, MODEL_DC_GAIN, CONTROL_TS)
+#define MODEL_C2    DISCRETIZE_ZOH_2POLE_B2(MODEL_POLE_1, MODEL_POLE_2, MODEL_DC_GAIN, CONTROL_TS)
+#if (TS_MS == 5)
+#define MODEL_KO    1.47229047      /**< Tuned on the rig, as in control.c. */
+#else
+#define MODEL_KO    DISCRETIZE_REFERENCE_GAIN(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, MODEL_C1, MODEL_C2, MODEL_K1, MODEL_K2)
+#endif
+
+#define CONTROL_C1  DISCRETIZE_POLY_C1(CONTROL_POLE_1, CONTROL_POLE_2)
+#define CONTROL_C2  DISCRETIZE_POLY_C2(CONTROL_POLE_1, CONTROL_POLE_2)
+
+#define OBSERVER_C1 DISCRETIZE_POLY_C1(OBSERVER_POLE_1, OBSERVER_POLE_2)
+#define OBSERVER_C2 DISCRETIZE_POLY_C2(OBSERVER_POLE_1, OBSERVER_POLE_2)
+
+#define MODEL_K1    DISCRETIZE_ACKERMANN_K1(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2)
+#define MODEL_K2    DISCRETIZE_ACKERMANN_K2(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_B1, MODEL_B2, CONTROL_C1, CONTROL_C2)
+#define MODEL_L1    DISCRETIZE_OBSERVER_L1(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_C1, MODEL_C2, OBSERVER_C1, OBSERVER_C2)
+#define MODEL_L2    DISCRETIZE_OBSERVER_L2(MODEL_A11, MODEL_A12, MODEL_A21, MODEL_A22, MODEL_C1, MODEL_C2, OBSERVER_C1, OBSERVER_C2)
+
+#if (STATE_SPACE_ARITHMETIC == STATE_SPACE_DOUBLE)
+#define ARITHMETIC_NAME     "double"
+#elif (STATE_SPACE_ARITHMETIC == STATE_SPACE_FLOAT)
+#define ARITHMETIC_NAME     "float"
+#else
+#define ARITHMETIC_NAME     "Q31"
+#endif
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/**
+ * @brief Plant simulated in double, x = A x + B u, y = C x.
+ */
+typedef struct {
+    double x[POLE_PLACEMENT_STATES];
+} plant_t;
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Convert volts to the representation, rounding to nearest.
+ */
+static state_space_real_t ToReal(double value);
+
+/**
+ * @brief Convert the representation to volts, without rounding.
+ */
+static double FromReal(state_space_real_t value);
+
+static double PlantOutput(const plant_t *plant);
+
+static void PlantStep(plant_t *plant, double u);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static const pole_placement_model_t model = {
+    .A = {
+        [0] = {STATE_SPACE_REAL(MODEL_A11), STATE_SPACE_REAL(MODEL_A12)},
+        [1] = {STATE_SPACE_REAL(MODEL_A21), STATE_SPACE_REAL(MODEL_A22)},
+    },
+    .B = {{STATE_SPACE_REAL(MODEL_B1)}, {STATE_SPACE_REAL(MODEL_B2)}},
+    .C = {{STATE_SPACE_REAL(MODEL_C1), STATE_SPACE_REAL(MODEL_C2)}},
+    .L = {{STATE_SPACE_REAL(MODEL_L1)}, {STATE_SPACE_REAL(MODEL_L2)}},
+};
+
+static const pole_placement_gain_t gain = {
+    .K = {{STATE_SPACE_REAL(MODEL_K1), STATE_SPACE_REAL(MODEL_K2)}},
+    .Ko = {{STATE_SPACE_REAL(MODEL_KO)}},
+};
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+int main(int argc, char *argv[]) {
+    double bound = DEFAULT_BOUND_MV;
+    uint32_t samples = DEFAULT_SAMPLES;
+    int option;
+
+    while ((option = getopt(argc, argv, "b:n:h")) != -1) {
+        switch (option) {
+            case 'b': bound = strtod(optarg, NULL); break;
+            case 'n': samples = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-b bound_mv] [-n samples]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    pole_placement_t observer;
+    POLE_PLACEMENT_Init(&observer, &model);
+    plant_t plant = {0};
+
+    double reference_x[POLE_PLACEMENT_STATES] = {0};   // Observer of the reference loop
+    plant_t reference_plant = {0};
+
+    double max_u = 0;
+    double max_y = 0;
+    uint32_t half_period = SQUARE_PERIOD_MS / 2 / TS_MS;
+
+    for (uint32_t k = 0; k < samples; k++) {
+        double r = ((k / half_period) % 2 == 0) ? REFERENCE_HIGH : REFERENCE_LOW;
+
+        // Kernels in the arithmetic under test, the order of CONTROLLER_PolePlacementControlObserver
+        state_space_real_t r_real = ToReal(r);
+        state_space_real_t y_real = ToReal(PlantOutput(&plant));
+        state_space_real_t u_real;
+        POLE_PLACEMENT_Control(&gain, observer.x, &r_real, &u_real);
+        POLE_PLACEMENT_Update(&observer, &u_real, &y_real);
+        double u = FromReal(u_real);
+        double y = PlantOutput(&plant);
+        PlantStep(&plant, u);
+
+        // Same loop in double
+        double y_ref = PlantOutput(&reference_plant);
+        double u_ref = (MODEL_KO * r) - (MODEL_K1 * reference_x[0]) - (MODEL_K2 * reference_x[1]);
+        double innovation = y_ref - (MODEL_C1 * reference_x[0]) - (MODEL_C2 * reference_x[1]);
+        double x0 = (MODEL_A11 * reference_x[0]) + (MODEL_A12 * reference_x[1]) + (MODEL_B1 * u_ref) + (MODEL_L1 * innovation);
+        double x1 = (MODEL_A21 * reference_x[0]) + (MODEL_A22 * reference_x[1]) + (MODEL_B2 * u_ref) + (MODEL_L2 * innovation);
+        reference_x[0] = x0;
+        reference_x[1] = x1;
+        PlantStep(&reference_plant, u_ref);
+
+        max_u = fmax(max_u, fabs(u - u_ref) * MV_PER_V);
+        max_y = fmax(max_y, fabs(y - y_ref) * MV_PER_V);
+    }
+
+    bool_t pass = (max_u <= bound) && (max_y <= bound);
+    printf("%s: %u samples, max |u - u_double| = %.4f mV, max |y - y_double| = %.4f mV, bound %.4f mV: %s\n",
+           ARITHMETIC_NAME, (unsigned)samples, max_u, max_y, bound, pass ? "PASS" : "FAIL");
+
+    return pass ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static state_space_real_t ToReal(double value) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return STATE_SPACE_REAL(value);
+    #else
+    return (state_space_real_t)value;
+    #endif
+}
+
+static double FromReal(state_space_real_t value) {
+    #if (STATE_SPACE_ARITHMETIC == STATE_SPACE_Q31)
+    return (double)value / (double)(1L << STATE_SPACE_FRAC_BITS);
+    #else
+    return (double)value;
+    #endif
+}
+
+static double PlantOutput(const plant_t *plant) {
+    return (MODEL_C1 * plant->x[0]) + (MODEL_C2 * plant->x[1]);
+}
+
+static void PlantStep(plant_t *plant, double u) {
+    double x0 = (MODEL_A11 * plant->x[0]) + (MODEL_A12 * plant->x[1]) + (MODEL_B1 * u);
+    double x1 = (MODEL_A21 * plant->x[0]) + (MODEL_A22 * plant->x[1]) + (MODEL_B2 * u);
+    plant->x[0] = x0;
+    plant->x[1] = x1;
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/
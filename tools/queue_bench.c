@@ -0,0 +1,153 @@
+/**
+ * @file queue_bench.c
+ * @author Marcos Dominguez
+ *
+ * @brief Per element cost of osal_queue, one call per element against batches, for the host.
+ *
+ * Fills a queue with OSAL_QUEUE_Send one element at a time and with
+ * OSAL_QUEUE_SendN in batches, drains it the same way with OSAL_QUEUE_Receive
+ * and OSAL_QUEUE_ReceiveN, and prints the nanoseconds per element of each for
+ * every batch size. It runs on the simulated FreeRTOS port, where the
+ * critical sections cost nothing, so it measures the OSAL and port layers
+ * and the copy; the critical section per element and the context switches a
+ * batch saves on the board come on top.
+ *
+ * Build from the root of the repository:
+ *
+ *     gcc -O2 -std=gnu11 -DTEST -DOS_FREERTOS=1 -DOS_USED=1 -Iinc -Iinc/OS_MANAGER -Iinc/port -Iinc/port/support tools/queue_bench.c src/osal_queue.c src/port/port_queue_freertos.c inc/port/support/FreeRTOS_queue_simulated.c inc/port/support/FreeRTOS_task_simulated.c -o queue_bench
+ *
+ * Usage:
+ *
+ *     queue_bench [-s element_size] [-n elements]
+ *
+ * @version 0.1
+ * @date 2026-10-16
+ */
+
+/*========= [DEPENDENCIES] =====================================================*/
+
+#include "osal_queue.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+/*========= [PRIVATE MACROS AND CONSTANTS] =====================================*/
+
+#define QUEUE_LENGTH        64          /**< Also the largest batch. */
+#define DEFAULT_SIZE        16          /**< Bytes of an element, a sample frame of four words. */
+#define DEFAULT_ELEMENTS    10000000    /**< Elements moved for each measurement. */
+#define MAX_SIZE            1024
+
+/*========= [PRIVATE DATA TYPES] ===============================================*/
+
+/*========= [TASK DECLARATIONS] ================================================*/
+
+/*========= [PRIVATE FUNCTION DECLARATIONS] ====================================*/
+
+/**
+ * @brief Monotonic time in ns.
+ */
+static double Now(void);
+
+/**
+ * @brief Move elements through the queue in rounds of batch, one call per element.
+ *
+ * @return double   ns per element sent and received.
+ */
+static double RunSingle(osal_queue_t *queue, uint8_t *buffer, uint16_t batch, uint32_t elements);
+
+/**
+ * @brief Move elements through the queue in rounds of batch, one call per round.
+ *
+ * @return double   ns per element sent and received.
+ */
+static double RunBatch(osal_queue_t *queue, uint8_t *buffer, uint16_t batch, uint32_t elements);
+
+/*========= [INTERRUPT FUNCTION DECLARATIONS] ==================================*/
+
+/*========= [LOCAL VARIABLES] ==================================================*/
+
+static volatile uint32_t sink = 0;     /**< Keeps the received data alive */
+
+/*========= [STATE FUNCTION POINTERS] ==========================================*/
+
+/*========= [PUBLIC FUNCTION IMPLEMENTATION] ===================================*/
+
+int main(int argc, char *argv[]) {
+    static osal_queue_holder_t holder;
+    static uint8_t storage[OSAL_QUEUE_StackSize(MAX_SIZE, QUEUE_LENGTH)];
+    static uint8_t buffer[MAX_SIZE * QUEUE_LENGTH];
+    uint32_t size = DEFAULT_SIZE;
+    uint32_t elements = DEFAULT_ELEMENTS;
+    osal_queue_t queue;
+    int option;
+
+    while ((option = getopt(argc, argv, "s:n:h")) != -1) {
+        switch (option) {
+            case 's': size = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'n': elements = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-s element_size] [-n elements]\n", argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+    if ((size == 0) || (size > MAX_SIZE) || (elements == 0)) {
+        fprintf(stderr, "element size from 1 to %d bytes\n", MAX_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    OSAL_QUEUE_LoadStruct(&queue, &holder, storage, size, QUEUE_LENGTH);
+    if (!OSAL_QUEUE_Create(&queue)) {
+        fprintf(stderr, "queue creation failed\n");
+        return EXIT_FAILURE;
+    }
+    memset(buffer, 0x5A, sizeof(buffer));
+
+    printf("element %u bytes, %u elements each\n", (unsigned)size, (unsigned)elements);
+    printf("batch,single_ns,batch_ns,speedup\n");
+    for (uint16_t batch = 1; batch <= QUEUE_LENGTH; batch *= 2) {
+        double single = RunSingle(&queue, buffer, batch, elements);
+        double batched = RunBatch(&queue, buffer, batch, elements);
+        printf("%u,%.2f,%.2f,%.2f\n", (unsigned)batch, single, batched, single / batched);
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*========= [PRIVATE FUNCTION IMPLEMENTATION] ==================================*/
+
+static double Now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((double)now.tv_sec * 1e9) + (double)now.tv_nsec;
+}
+
+static double RunSingle(osal_queue_t *queue, uint8_t *buffer, uint16_t batch, uint32_t elements) {
+    uint32_t rounds = elements / batch;
+    double start = Now();
+    for (uint32_t r = 0; r < rounds; r++) {
+        for (uint16_t i = 0; i < batch; i++) {
+            OSAL_QUEUE_Send(queue, &buffer[i * queue->data_size], 0);
+        }
+        for (uint16_t i = 0; i < batch; i++) {
+            OSAL_QUEUE_Receive(queue, &buffer[i * queue->data_size], 0);
+        }
+        sink += buffer[0];
+    }
+    return (Now() - start) / ((double)rounds * batch);
+}
+
+static double RunBatch(osal_queue_t *queue, uint8_t *buffer, uint16_t batch, uint32_t elements) {
+    uint32_t rounds = elements / batch;
+    double start = Now();
+    for (uint32_t r = 0; r < rounds; r++) {
+        OSAL_QUEUE_SendN(queue, buffer, batch, 0);
+        OSAL_QUEUE_ReceiveN(queue, buffer, batch, 0);
+        sink += buffer[0];
+    }
+    return (Now() - start) / ((double)rounds * batch);
+}
+
+/*========= [INTERRUPT FUNCTION IMPLEMENTATION] ================================*/